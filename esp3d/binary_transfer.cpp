@@ -0,0 +1,389 @@
+/*
+  binary_transfer.cpp - ESP3D Marlin binary file transfer class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#if !defined(USE_AS_UPDATER_ONLY) && defined(BINARY_TRANSFER_FEATURE)
+#include "binary_transfer.h"
+#include "espcom.h"
+#include "response_classifier.h"
+#include "metrics.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
+
+#define NB_RETRY 5
+
+//packet start token 0xB5AD
+#define BINARY_TOKEN_LOW 0xAD
+#define BINARY_TOKEN_HIGH 0xB5
+#define BINARY_HEADER_SIZE 8
+//protocols and packet types
+#define PROTOCOL_CONTROL 0
+#define CONTROL_SYNC 1
+#define CONTROL_CLOSE 2
+#define PROTOCOL_FILE 1
+#define FILE_TRANSFER_QUERY 0
+#define FILE_TRANSFER_OPEN 1
+#define FILE_TRANSFER_CLOSE 2
+#define FILE_TRANSFER_WRITE 3
+#define FILE_TRANSFER_ABORT 4
+
+BinaryTransfer binary_transfer;
+
+static uint16_t fletcher16(uint16_t cs, uint8_t value)
+{
+    uint16_t cs_low = ((cs & 0xFF) + value) % 255;
+    return ((((cs >> 8) + cs_low) % 255) << 8) | cs_low;
+}
+
+BinaryTransfer::BinaryTransfer()
+{
+    _started = false;
+    _failed = false;
+    _sync = 0;
+    _block_size = BINARY_TRANSFER_BLOCK_SIZE;
+    _block_used = 0;
+    _bytes_sent = 0;
+    _resend_total = 0;
+    _response_number = -1;
+}
+
+//read printer output until a line is complete
+BinaryTransfer::response_type BinaryTransfer::readResponse(uint32_t timeout)
+{
+    uint32_t start = millis();
+    uint8_t c;
+    while ((millis() - start) < timeout) {
+        if (ESPCOM::available(DEFAULT_PRINTER_PIPE) == 0) {
+            CONFIG::wait(0);
+            continue;
+        }
+        //byte per byte so nothing after the line is lost
+        if ((ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, &c, 1) != 1) || (_answer.feed (&c, 1) != 1) || !_answer.ready()) {
+            continue;
+        }
+        const char * line = _answer.line();
+        //binary answers are ok<sync>, rs<sync>, ss<sync>,<block size>,<version> and fe<sync>
+        if ((_answer.length() > 2) && isdigit(line[2])) {
+            _response_number = atoi(line + 2);
+            if (strncmp(line, "ok", 2) == 0) {
+                return BINARY_RESPONSE_ACK;
+            }
+            if (strncmp(line, "rs", 2) == 0) {
+                return BINARY_RESPONSE_RESEND;
+            }
+            if (strncmp(line, "ss", 2) == 0) {
+                return BINARY_RESPONSE_SYNC;
+            }
+            if (strncmp(line, "fe", 2) == 0) {
+                return BINARY_RESPONSE_FATAL;
+            }
+        }
+        if (strncmp(line, "PFT:", 4) == 0) {
+            return BINARY_RESPONSE_FILE;
+        }
+        return BINARY_RESPONSE_OTHER;
+    }
+    return BINARY_RESPONSE_NONE;
+}
+
+bool BinaryTransfer::supported()
+{
+    response_info response;
+    bool found = false;
+    if (CONFIG::GetFirmwareTarget() != MARLIN) {
+        return false;
+    }
+    _answer.reset();
+    ESPCOM::println (F ("M115"), DEFAULT_PRINTER_PIPE);
+    ESPCOM::flush (DEFAULT_PRINTER_PIPE);
+    //capabilities come before the ok
+    while (readResponse(BINARY_TRANSFER_TIMEOUT) != BINARY_RESPONSE_NONE) {
+        if (strstr(_answer.line(), "Cap:BINARY_FILE_TRANSFER:1")) {
+            found = true;
+        }
+        ResponseClassifier::classify (_answer.line(), _answer.length(), response);
+        if (response.type == RESPONSE_ACK) {
+            break;
+        }
+    }
+    log_esp3d("Binary transfer %s", found ? "supported" : "not supported");
+    return found;
+}
+
+//uart write can be partial when tx buffer is full
+bool BinaryTransfer::sendBytes(const uint8_t * data, size_t len)
+{
+    uint32_t start = millis();
+    while (len > 0) {
+        size_t sent = ESPCOM::write (DEFAULT_PRINTER_PIPE, data, len);
+        data += sent;
+        len -= sent;
+        if (len > 0) {
+            if ((millis() - start) > BINARY_TRANSFER_TIMEOUT) {
+                return false;
+            }
+            CONFIG::wait(0);
+        }
+    }
+    return true;
+}
+
+bool BinaryTransfer::sendPacket(uint8_t protocol, uint8_t type, const uint8_t * data, uint16_t size)
+{
+    uint8_t header[BINARY_HEADER_SIZE];
+    uint8_t footer[2];
+    uint16_t cs = 0;
+    header[0] = BINARY_TOKEN_LOW;
+    header[1] = BINARY_TOKEN_HIGH;
+    header[2] = _sync;
+    header[3] = (protocol << 4) | (type & 0x0F);
+    header[4] = size & 0xFF;
+    header[5] = size >> 8;
+    //token is not part of checksums
+    for (uint8_t i = 2; i < 6; i++) {
+        cs = fletcher16(cs, header[i]);
+    }
+    header[6] = cs & 0xFF;
+    header[7] = cs >> 8;
+    //packet checksum goes on from header one
+    cs = fletcher16(cs, header[6]);
+    cs = fletcher16(cs, header[7]);
+    for (uint16_t i = 0; i < size; i++) {
+        cs = fletcher16(cs, data[i]);
+    }
+    if (!sendBytes(header, BINARY_HEADER_SIZE)) {
+        return false;
+    }
+    //packet without payload has no packet checksum
+    if (size == 0) {
+        return true;
+    }
+    footer[0] = cs & 0xFF;
+    footer[1] = cs >> 8;
+    return sendBytes(data, size) && sendBytes(footer, 2);
+}
+
+//send packet until printer acknowledges it
+bool BinaryTransfer::exchange(uint8_t protocol, uint8_t type, const uint8_t * data, uint16_t size)
+{
+    for (uint8_t retry = 0; retry <= NB_RETRY; retry++) {
+        if (retry > 0) {
+            log_esp3d("Resend packet %d", _sync);
+            _resend_total++;
+            Metrics::add (METRIC_RESENDS);
+        }
+        if (!sendPacket(protocol, type, data, size)) {
+            return false;
+        }
+        uint32_t start = millis();
+        bool resend = false;
+        while (!resend && ((millis() - start) < BINARY_TRANSFER_TIMEOUT)) {
+            switch (readResponse(BINARY_TRANSFER_TIMEOUT)) {
+            case BINARY_RESPONSE_ACK:
+                if (_response_number == _sync) {
+                    _sync++;
+                    return true;
+                }
+                //ok of a previous packet sent again
+                break;
+            case BINARY_RESPONSE_RESEND:
+                resend = true;
+                break;
+            case BINARY_RESPONSE_FATAL:
+                log_esp3d("Binary stream fatal error");
+                return false;
+            case BINARY_RESPONSE_FILE:
+                if (strcmp(_answer.line(), "PFT:ioerror") == 0) {
+                    log_esp3d("Printer write error");
+                    return false;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return false;
+}
+
+//get printer stream sync and block size, it does not need current sync
+bool BinaryTransfer::syncStream()
+{
+    for (uint8_t retry = 0; retry <= NB_RETRY; retry++) {
+        if (!sendPacket(PROTOCOL_CONTROL, CONTROL_SYNC, NULL, 0)) {
+            return false;
+        }
+        uint32_t start = millis();
+        while ((millis() - start) < BINARY_TRANSFER_TIMEOUT) {
+            if (readResponse(BINARY_TRANSFER_TIMEOUT) != BINARY_RESPONSE_SYNC) {
+                continue;
+            }
+            const char * p = strchr(_answer.line(), ',');
+            uint16_t size = p ? atoi(p + 1) : 0;
+            if (size == 0) {
+                return false;
+            }
+            _sync = _response_number;
+            _block_size = (size < BINARY_TRANSFER_BLOCK_SIZE) ? size : BINARY_TRANSFER_BLOCK_SIZE;
+            log_esp3d("Binary stream sync %d, block %d", _sync, _block_size);
+            return true;
+        }
+    }
+    return false;
+}
+
+//file packets are answered by PFT:<status> after the ok
+bool BinaryTransfer::fileCommand(uint8_t type, const uint8_t * data, uint16_t size, const char * expected, uint32_t timeout)
+{
+    if (!exchange(PROTOCOL_FILE, type, data, size)) {
+        return false;
+    }
+    uint32_t start = millis();
+    while ((millis() - start) < timeout) {
+        if (readResponse(timeout) == BINARY_RESPONSE_FILE) {
+            log_esp3d("File answer %s", _answer.line());
+            return strncmp(_answer.line(), expected, strlen(expected)) == 0;
+        }
+    }
+    return false;
+}
+
+//back to ascii mode, a new line ends what printer got if it was not in binary mode
+void BinaryTransfer::leave()
+{
+    if (syncStream()) {
+        exchange(PROTOCOL_CONTROL, CONTROL_CLOSE, NULL, 0);
+    }
+    ESPCOM::print ("\n", DEFAULT_PRINTER_PIPE);
+    ESPCOM::flush (DEFAULT_PRINTER_PIPE);
+}
+
+bool BinaryTransfer::begin(const char * filename)
+{
+    response_info response;
+    size_t len = strlen(filename);
+    _started = false;
+    _failed = false;
+    _sync = 0;
+    _block_size = BINARY_TRANSFER_BLOCK_SIZE;
+    _block_used = 0;
+    _bytes_sent = 0;
+    _resend_total = 0;
+    _answer.reset();
+#ifdef MEATPACK_FEATURE
+    //packets must reach printer as they are
+    MeatPack::suspend();
+#endif
+    ESPCOM::println (F ("M28 B1"), DEFAULT_PRINTER_PIPE);
+    ESPCOM::flush (DEFAULT_PRINTER_PIPE);
+    //printer switches to binary mode once command is processed
+    while (readResponse(BINARY_TRANSFER_TIMEOUT) != BINARY_RESPONSE_NONE) {
+        ResponseClassifier::classify (_answer.line(), _answer.length(), response);
+        if (response.type == RESPONSE_ACK) {
+            break;
+        }
+    }
+    if (!syncStream()) {
+        log_esp3d("Binary stream sync failed");
+        leave();
+        return false;
+    }
+    //open payload is dummy flag, compression flag and filename with its 0
+    if (((len + 3) > _block_size) ||
+            !fileCommand(FILE_TRANSFER_QUERY, NULL, 0, "PFT:version:", BINARY_TRANSFER_TIMEOUT)) {
+        leave();
+        return false;
+    }
+    _block[0] = 0;
+    _block[1] = 0;
+    memcpy(_block + 2, filename, len + 1);
+    if (!fileCommand(FILE_TRANSFER_OPEN, _block, len + 3, "PFT:success", BINARY_TRANSFER_TIMEOUT)) {
+        log_esp3d("Binary file open failed");
+        leave();
+        return false;
+    }
+    _started = true;
+    return true;
+}
+
+bool BinaryTransfer::flushBlock()
+{
+    if (_block_used == 0) {
+        return true;
+    }
+    if (!exchange(PROTOCOL_FILE, FILE_TRANSFER_WRITE, _block, _block_used)) {
+        _failed = true;
+        return false;
+    }
+    _bytes_sent += _block_used;
+    _block_used = 0;
+    return true;
+}
+
+bool BinaryTransfer::write(const uint8_t * data, size_t len)
+{
+    if (!_started || _failed) {
+        return false;
+    }
+    while (len > 0) {
+        size_t size = _block_size - _block_used;
+        if (size > len) {
+            size = len;
+        }
+        memcpy(_block + _block_used, data, size);
+        _block_used += size;
+        data += size;
+        len -= size;
+        if ((_block_used == _block_size) && !flushBlock()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BinaryTransfer::end()
+{
+    if (!_started || _failed || !flushBlock()) {
+        return false;
+    }
+    if (!fileCommand(FILE_TRANSFER_CLOSE, NULL, 0, "PFT:success", BINARY_TRANSFER_CLOSE_TIMEOUT)) {
+        _failed = true;
+        return false;
+    }
+    log_esp3d("Binary transfer done: %d bytes, %d resend", _bytes_sent, _resend_total);
+    leave();
+    _started = false;
+    return true;
+}
+
+void BinaryTransfer::abort()
+{
+    if (!_started) {
+        return;
+    }
+    //stream may have been reset by a fatal error so sync again first
+    if (syncStream()) {
+        fileCommand(FILE_TRANSFER_ABORT, NULL, 0, "PFT:success", BINARY_TRANSFER_TIMEOUT);
+    }
+    leave();
+    _started = false;
+}
+#endif //USE_AS_UPDATER_ONLY && BINARY_TRANSFER_FEATURE
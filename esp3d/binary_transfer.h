@@ -0,0 +1,95 @@
+/*
+  binary_transfer.h - ESP3D Marlin binary file transfer class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _BINARY_TRANSFER_H
+#define _BINARY_TRANSFER_H
+#include <Arduino.h>
+#include "config.h"
+#include "line_assembler.h"
+
+//biggest payload sent, printer may ask for less in its sync answer
+#define BINARY_TRANSFER_BLOCK_SIZE 512
+//no ok for a packet during this time means it is sent again
+#define BINARY_TRANSFER_TIMEOUT 1000
+//file close flushes data to SD, it can be long
+#define BINARY_TRANSFER_CLOSE_TIMEOUT 5000
+
+//Marlin BINARY_FILE_TRANSFER protocol (M28 B1):
+//packet is token(2) sync(1) protocol|type(1) size(2) header checksum(2) [payload packet checksum(2)]
+//all little endian, checksums are fletcher-16 of all bytes after token
+//printer buffers one packet only, so each packet waits its ok<sync> before next one
+class BinaryTransfer
+{
+public:
+    BinaryTransfer();
+    //printer advertises BINARY_FILE_TRANSFER in M115 capabilities
+    bool supported();
+    //switch printer to binary mode and create file, printer is back in ascii mode if it fails
+    bool begin(const char * filename);
+    bool write(const uint8_t * data, size_t len);
+    //close file and switch printer back to ascii mode
+    bool end();
+    //remove file and switch printer back to ascii mode
+    void abort();
+    bool started()
+    {
+        return _started;
+    };
+    uint32_t bytesSent()
+    {
+        return _bytes_sent;
+    };
+    uint32_t resendCount()
+    {
+        return _resend_total;
+    };
+private:
+    enum response_type {
+        BINARY_RESPONSE_NONE,
+        BINARY_RESPONSE_ACK,
+        BINARY_RESPONSE_RESEND,
+        BINARY_RESPONSE_SYNC,
+        BINARY_RESPONSE_FATAL,
+        BINARY_RESPONSE_FILE,
+        BINARY_RESPONSE_OTHER
+    };
+    bool _started;
+    bool _failed;
+    uint8_t _sync;
+    uint16_t _block_size;
+    uint16_t _block_used;
+    uint32_t _bytes_sent;
+    uint32_t _resend_total;
+    int32_t _response_number;
+    uint8_t _block[BINARY_TRANSFER_BLOCK_SIZE];
+    LineAssembler _answer;
+    bool sendBytes(const uint8_t * data, size_t len);
+    bool sendPacket(uint8_t protocol, uint8_t type, const uint8_t * data, uint16_t size);
+    bool exchange(uint8_t protocol, uint8_t type, const uint8_t * data, uint16_t size);
+    bool syncStream();
+    bool fileCommand(uint8_t type, const uint8_t * data, uint16_t size, const char * expected, uint32_t timeout);
+    bool flushBlock();
+    void leave();
+    response_type readResponse(uint32_t timeout);
+};
+
+extern BinaryTransfer binary_transfer;
+
+#endif //_BINARY_TRANSFER_H
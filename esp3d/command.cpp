@@ -21,6 +21,16 @@
 #include "command.h"
 #include "wificonf.h"
 #include "webinterface.h"
+#include "serial_query.h"
+#include "response_classifier.h"
+#include "metrics.h"
+#include "printer_state.h"
+#ifdef GCODE_MINIFIER_FEATURE
+#include "gcode_minifier.h"
+#endif
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
 #ifndef FS_NO_GLOBALS
 #define FS_NO_GLOBALS
 #endif
@@ -48,8 +58,10 @@ extern DHTesp dht;
 #include "notifications_service.h"
 #endif
 
-String COMMAND::buffer_serial;
-String COMMAND::buffer_tcp;
+LineAssembler COMMAND::buffer_serial;
+#ifdef TCP_IP_DATA_FEATURE
+LineAssembler COMMAND::buffer_tcp;
+#endif
 
 #define ERROR_CMD_MSG (output == WEB_PIPE)?F("Error: Wrong Command"):F("Cmd Error")
 #define INCORRECT_CMD_MSG (output == WEB_PIPE)?F("Error: Incorrect Command"):F("Incorrect Cmd")
@@ -122,17 +134,21 @@ String COMMAND::get_param (String & cmd_params, const char * id, bool withspace)
     return parameter;
 }
 #ifdef AUTHENTICATION_FEATURE
+//check password given in command against the one stored at position pos
+static bool check_password (String & password, int pos, const char * default_password)
+{
+    String spassword;
+    if (!CONFIG::read_string (pos, spassword, MAX_LOCAL_PASSWORD_LENGTH) ) {
+        LOG ("ERROR getting password\r\n")
+        spassword = FPSTR (default_password);
+    }
+    return spassword.equals (password);
+}
 //check admin password
 bool COMMAND::isadmin (String & cmd_params)
 {
-    String adminpassword;
-    String sadminPassword;
-    if (!CONFIG::read_string (EP_ADMIN_PWD, sadminPassword, MAX_LOCAL_PASSWORD_LENGTH) ) {
-        LOG ("ERROR getting admin\r\n")
-        sadminPassword = FPSTR (DEFAULT_ADMIN_PWD);
-    }
-    adminpassword = get_param (cmd_params, "pwd=", true);
-    if (!sadminPassword.equals (adminpassword) ) {
+    String adminpassword = get_param (cmd_params, "pwd=", true);
+    if (!check_password (adminpassword, EP_ADMIN_PWD, DEFAULT_ADMIN_PWD) ) {
         LOG("Not identified from command line\r\n")
         return false;
     } else {
@@ -142,21 +158,88 @@ bool COMMAND::isadmin (String & cmd_params)
 //check user password - admin password is also valid
 bool COMMAND::isuser (String & cmd_params)
 {
-    String userpassword;
-    String suserPassword;
-    if (!CONFIG::read_string (EP_USER_PWD, suserPassword, MAX_LOCAL_PASSWORD_LENGTH) ) {
-        LOG ("ERROR getting user\r\n")
-        suserPassword = FPSTR (DEFAULT_USER_PWD);
-    }
-    userpassword = get_param (cmd_params, "pwd=", true);
+    String userpassword = get_param (cmd_params, "pwd=", true);
     //it is not user password
-    if (!suserPassword.equals (userpassword) ) {
+    if (!check_password (userpassword, EP_USER_PWD, DEFAULT_USER_PWD) ) {
         //check admin password
-        return COMMAND::isadmin (cmd_params);
+        return check_password (userpassword, EP_ADMIN_PWD, DEFAULT_ADMIN_PWD);
     } else {
         return true;
     }
 }
+
+//authentication level needed by each [ESPxxx] command to use all its features
+//must be sorted by id, commands not listed do not need authentication
+typedef struct {
+    uint16_t id;
+    uint8_t level;
+} command_auth_entry;
+
+static const command_auth_entry command_auth[] = {
+    {100, LEVEL_ADMIN}, {101, LEVEL_ADMIN}, {102, LEVEL_ADMIN}, {103, LEVEL_ADMIN},
+    {104, LEVEL_ADMIN}, {105, LEVEL_ADMIN}, {106, LEVEL_ADMIN}, {107, LEVEL_ADMIN},
+    {110, LEVEL_ADMIN},
+    {201, LEVEL_USER},
+    {290, LEVEL_USER},
+    //user or admin depending on setting
+    {401, LEVEL_ADMIN},
+    //POLL= only, state can be read by anyone
+    {421, LEVEL_USER},
+    //ON/OFF only
+    {422, LEVEL_USER},
+    {430, LEVEL_USER},
+    {444, LEVEL_ADMIN},
+    {555, LEVEL_ADMIN},
+    {600, LEVEL_USER}, {610, LEVEL_USER},
+    //commands in macro are executed with same level
+    {700, LEVEL_ADMIN},
+    {710, LEVEL_ADMIN},
+    {900, LEVEL_USER}
+};
+
+static level_authenticate_type get_needed_level (int cmd)
+{
+    int first = 0;
+    int last = (sizeof (command_auth) / sizeof (command_auth_entry)) - 1;
+    while (first <= last) {
+        int middle = (first + last) / 2;
+        if (command_auth[middle].id == cmd) {
+            return (level_authenticate_type) command_auth[middle].level;
+        }
+        if (command_auth[middle].id < cmd) {
+            first = middle + 1;
+        } else {
+            last = middle - 1;
+        }
+    }
+    return LEVEL_GUEST;
+}
+
+//passwords are only read from EEPROM when command needs them
+level_authenticate_type COMMAND::get_auth_level (int cmd, String & cmd_params, level_authenticate_type auth_level)
+{
+    level_authenticate_type auth_need = get_needed_level (cmd);
+    if (auth_level >= auth_need) {
+        return auth_level;
+    }
+    //pwd= is parsed only once
+    String password = get_param (cmd_params, "pwd=", true);
+    if (auth_need == LEVEL_ADMIN) {
+        if (check_password (password, EP_ADMIN_PWD, DEFAULT_ADMIN_PWD) ) {
+            LOG("you are Admin\r\n");
+            return LEVEL_ADMIN;
+        }
+        if ((auth_level == LEVEL_GUEST) && check_password (password, EP_USER_PWD, DEFAULT_USER_PWD) ) {
+            LOG("you are User\r\n");
+            return LEVEL_USER;
+        }
+    } else if (check_password (password, EP_USER_PWD, DEFAULT_USER_PWD) || check_password (password, EP_ADMIN_PWD, DEFAULT_ADMIN_PWD) ) {
+        //user level is enough, no need to know if it is admin
+        LOG("you are User\r\n");
+        return LEVEL_USER;
+    }
+    return auth_level;
+}
 #endif
 bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_authenticate_type auth_level, ESPResponseStream  *espresponse)
 {
@@ -164,15 +247,7 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
     level_authenticate_type auth_type = auth_level;
     (void)auth_type;  //avoid warning if updater only
 #ifdef AUTHENTICATION_FEATURE
-
-    if (isadmin(cmd_params)) {
-        auth_type = LEVEL_ADMIN;
-        LOG("you are Admin\r\n");
-    }
-    if (isuser (cmd_params) && (auth_type != LEVEL_ADMIN) ) {
-        auth_type = LEVEL_USER;
-        LOG("you are User\r\n");
-    }
+    auth_type = get_auth_level (cmd, cmd_params, auth_level);
 #ifdef DEBUG_ESP3D
     if ( auth_type == LEVEL_ADMIN) {
         LOG("admin identified\r\n");
@@ -764,650 +839,7 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
     //Get full EEPROM settings content
     //[ESP400]
     case 400: {
-        char sbuf[MAX_DATA_LENGTH + 1];
-        uint8_t ipbuf[4];
-        byte bbuf = 0;
-        int ibuf = 0;
-        parameter = get_param (cmd_params, "", true);
-        //Start JSON
-        ESPCOM::println (F ("{\"EEPROM\":["), output, espresponse);
-        if (cmd_params == "network" || cmd_params == "") {
-
-            //1- Baud Rate
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_BAUD_RATE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"I\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_BAUD_RATE,  (byte *) &ibuf, INTEGER_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (ibuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Baud Rate\",\"O\":[{\"9600\":\"9600\"},{\"19200\":\"19200\"},{\"38400\":\"38400\"},{\"57600\":\"57600\"},{\"115200\":\"115200\"},{\"230400\":\"230400\"},{\"250000\":\"250000\"},{\"500000\":\"500000\"},{\"921600\":\"921600\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //2-Sleep Mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_SLEEP_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_SLEEP_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Sleep Mode\",\"O\":[{\"None\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_NONE_SLEEP), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Light\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_LIGHT_SLEEP), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Modem\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_MODEM_SLEEP), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //3-Web Port
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_WEB_PORT), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"I\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_WEB_PORT,  (byte *) &ibuf, INTEGER_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (ibuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Web Port\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DEFAULT_MAX_WEB_PORT), output, espresponse);
-            ESPCOM::print (F ("\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DEFAULT_MIN_WEB_PORT), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //4-Data Port
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_DATA_PORT), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"I\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_DATA_PORT,  (byte *) &ibuf, INTEGER_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (ibuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Data Port\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DEFAULT_MAX_DATA_PORT), output, espresponse);
-            ESPCOM::print (F ("\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DEFAULT_MIN_DATA_PORT), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-#ifdef AUTHENTICATION_FEATURE
-            //5-Admin password
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_ADMIN_PWD), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_ADMIN_PWD, sbuf, MAX_LOCAL_PASSWORD_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_LOCAL_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Admin Password\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_LOCAL_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //6-User password
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_USER_PWD), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_USER_PWD, sbuf, MAX_LOCAL_PASSWORD_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_LOCAL_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"User Password\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_LOCAL_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-#endif
-            //7-Hostname
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_HOSTNAME), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_HOSTNAME, sbuf, MAX_HOSTNAME_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Hostname\" ,\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_HOSTNAME_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\", \"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_HOSTNAME_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //8-wifi mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_WIFI_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_WIFI_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Wifi mode\",\"O\":[{\"AP\":\"1\"},{\"STA\":\"2\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //9-STA SSID
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_SSID), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_STA_SSID, sbuf, MAX_SSID_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_SSID_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Station SSID\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_SSID_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //10-STA password
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_PASSWORD), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_STA_PASSWORD, sbuf, MAX_PASSWORD_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Station Password\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //11-Station Network Mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_PHY_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_STA_PHY_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Station Network Mode\",\"O\":[{\"11b\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_PHY_MODE_11B), output, espresponse);
-            ESPCOM::print (F ("\"},{\"11g\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_PHY_MODE_11G), output, espresponse);
-            ESPCOM::print (F ("\"},{\"11n\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_PHY_MODE_11N), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //12-STA IP mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_IP_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_STA_IP_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Station IP Mode\",\"O\":[{\"DHCP\":\"1\"},{\"Static\":\"2\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //13-STA static IP
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_IP_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_STA_IP_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Station Static IP\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //14-STA static Mask
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_MASK_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_STA_MASK_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Station Static Mask\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //15-STA static Gateway
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_STA_GATEWAY_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_STA_GATEWAY_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Station Static Gateway\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //16-AP SSID
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_SSID), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_AP_SSID, sbuf, MAX_SSID_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_SSID_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"AP SSID\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_SSID_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //17-AP password
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_PASSWORD), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_AP_PASSWORD, sbuf, MAX_PASSWORD_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"AP Password\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_PASSWORD_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //18 - AP Network Mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_PHY_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_AP_PHY_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP Network Mode\",\"O\":[{\"11b\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_PHY_MODE_11B), output, espresponse);
-            ESPCOM::print (F ("\"},{\"11g\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (WIFI_PHY_MODE_11G), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //19-AP SSID visibility
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_SSID_VISIBLE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_SSID_VISIBLE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"SSID Visible\",\"O\":[{\"No\":\"0\"},{\"Yes\":\"1\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //20-AP Channel
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_CHANNEL), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_CHANNEL, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP Channel\",\"O\":["), output, espresponse);
-            for (int i = 1; i < 12 ; i++) {
-                ESPCOM::print (F ("{\""), output, espresponse);
-                ESPCOM::print ( (const char *) CONFIG::intTostr (i), output, espresponse);
-                ESPCOM::print (F ("\":\""), output, espresponse);
-                ESPCOM::print ( (const char *) CONFIG::intTostr (i), output, espresponse);
-                ESPCOM::print (F ("\"}"), output, espresponse);
-                if (i < 11) {
-                    ESPCOM::print (F (","), output, espresponse);
-                }
-            }
-            ESPCOM::print (F ("]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //21-AP Authentication
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AUTH_TYPE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_AUTH_TYPE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Authentication\",\"O\":[{\"Open\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (AUTH_OPEN), output, espresponse);
-            ESPCOM::print (F ("\"},{\"WPA\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (AUTH_WPA_PSK), output, espresponse);
-            ESPCOM::print (F ("\"},{\"WPA2\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (AUTH_WPA2_PSK), output, espresponse);
-            ESPCOM::print (F ("\"},{\"WPA/WPA2\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (AUTH_WPA_WPA2_PSK), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //22-AP IP mode
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_IP_MODE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_AP_IP_MODE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP IP Mode\",\"O\":[{\"DHCP\":\"1\"},{\"Static\":\"2\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //23-AP static IP
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_IP_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_AP_IP_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP Static IP\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //24-AP static Mask
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_MASK_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_AP_MASK_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP Static Mask\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //25-AP static Gateway
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_AP_GATEWAY_VALUE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"A\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_buffer (EP_AP_GATEWAY_VALUE, (byte *) ipbuf, IP_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (IPAddress (ipbuf).toString().c_str(), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"AP Static Gateway\"}"), output, espresponse);
-#if defined(TIMESTAMP_FEATURE)
-            ESPCOM::println (F (","), output, espresponse);
-            //26-Time zone
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TIMEZONE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_TIMEZONE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr ( (int8_t) bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Time Zone\",\"O\":["), output, espresponse);
-            for (int i = -12; i <= 12 ; i++) {
-                ESPCOM::print (F ("{\""), output, espresponse);
-                ESPCOM::print ( (const char *) CONFIG::intTostr (i), output, espresponse);
-                ESPCOM::print (F ("\":\""), output, espresponse);
-                ESPCOM::print ( (const char *) CONFIG::intTostr (i), output, espresponse);
-                ESPCOM::print (F ("\"}"), output, espresponse);
-                if (i < 12) {
-                    ESPCOM::print (F (","), output, espresponse);
-                }
-            }
-            ESPCOM::print (F ("]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //27- DST
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TIME_ISDST), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_TIME_ISDST, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Day Saving Time\",\"O\":[{\"No\":\"0\"},{\"Yes\":\"1\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //28- Time Server1
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TIME_SERVER1), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_TIME_SERVER1, sbuf, MAX_DATA_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Time Server 1\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //29- Time Server2
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TIME_SERVER2), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_TIME_SERVER2, sbuf, MAX_DATA_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Time Server 2\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //30- Time Server3
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TIME_SERVER3), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (EP_TIME_SERVER3, sbuf, MAX_DATA_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"Time Server 3\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_DATA_LENGTH), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-#endif
-
-#ifdef NOTIFICATION_FEATURE
-            ESPCOM::println (F (","), output, espresponse);
-            //Notification type
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_NOTIFICATION_TYPE), output, espresponse);
-            ESPCOM::print (F("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (ESP_NOTIFICATION_TYPE, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F("\",\"H\":\"Notification\",\"O\":[{\"None\":\"0\"},{\"Pushover\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_PUSHOVER_NOTIFICATION), output, espresponse);
-            ESPCOM::print (F("\"},{\"Email\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_EMAIL_NOTIFICATION), output, espresponse);
-            ESPCOM::print (F("\"},{\"Line\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_LINE_NOTIFICATION), output, espresponse);
-            ESPCOM::print (F("\"},{\"IFTTT\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_IFTTT_NOTIFICATION), output, espresponse);
-            ESPCOM::print (F("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-            //Token 1
-            ESPCOM::print (F("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_NOTIFICATION_TOKEN1), output, espresponse);
-            ESPCOM::print ( F("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (ESP_NOTIFICATION_TOKEN1, sbuf, MAX_NOTIFICATION_TOKEN_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print ( F("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_NOTIFICATION_TOKEN_LENGTH), output, espresponse);
-            ESPCOM::print ( F ("\",\"H\":\"Token 1\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_NOTIFICATION_TOKEN_LENGTH), output, espresponse);
-            ESPCOM::print ( F("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-            //Token 2
-            ESPCOM::print (F("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_NOTIFICATION_TOKEN2), output, espresponse);
-            ESPCOM::print ( F("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (ESP_NOTIFICATION_TOKEN2, sbuf, MAX_NOTIFICATION_TOKEN_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ("********", output, espresponse);
-            }
-            ESPCOM::print ( F("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_NOTIFICATION_TOKEN_LENGTH), output, espresponse);
-            ESPCOM::print ( F ("\",\"H\":\"Token 2\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_NOTIFICATION_TOKEN_LENGTH), output, espresponse);
-            ESPCOM::print ( F("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-            //Notifications Settings
-            ESPCOM::print (F("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_NOTIFICATION_SETTINGS), output, espresponse);
-            ESPCOM::print ( F("\",\"T\":\"S\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_string (ESP_NOTIFICATION_SETTINGS, sbuf, MAX_NOTIFICATION_TOKEN_LENGTH) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print (encodeString(sbuf), output, espresponse);
-            }
-            ESPCOM::print ( F("\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MAX_NOTIFICATION_SETTINGS_LENGTH), output, espresponse);
-            ESPCOM::print ( F ("\",\"H\":\"Notifications Settings\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MIN_NOTIFICATION_SETTINGS_LENGTH), output, espresponse);
-            ESPCOM::print ( F("\"}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-            //Auto Notification
-            ESPCOM::print (F ("{\"F\":\"network\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (ESP_AUTO_NOTIFICATION), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (ESP_AUTO_NOTIFICATION, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Auto notification\",\"O\":[{\"No\":\"0\"},{\"Yes\":\"1\"}]}"), output, espresponse);
-
-
-#endif //NOTIFICATION_FEATURE
-        }
-
-        if (cmd_params == "printer" || cmd_params == "") {
-            if (cmd_params == "") {
-                ESPCOM::println (F (","), output, espresponse);
-            }
-            //Target FW
-            ESPCOM::print (F ("{\"F\":\"printer\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_TARGET_FW), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_TARGET_FW, &bbuf ) ) {
-                ESPCOM::print ("Unknown", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            ESPCOM::print (F ("\",\"H\":\"Target FW\",\"O\":[{\"Repetier\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (REPETIER), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Repetier for Davinci\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (REPETIER4DV), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Marlin\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MARLIN), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Marlin Kimbra\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (MARLINKIMBRA), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Smoothieware\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (SMOOTHIEWARE), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Grbl\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (GRBL), output, espresponse);
-            ESPCOM::print (F ("\"},{\"Unknown\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (UNKNOWN_FW), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-            ESPCOM::println (F (","), output, espresponse);
-
-            //Output flag
-            ESPCOM::print (F ("{\"F\":\"printer\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_OUTPUT_FLAG), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"F\",\"V\":\""), output, espresponse);
-            if (!CONFIG::read_byte (EP_OUTPUT_FLAG, &bbuf ) ) {
-                ESPCOM::print ("???", output, espresponse);
-            } else {
-                ESPCOM::print ( (const char *) CONFIG::intTostr (bbuf), output, espresponse);
-            }
-            String s = "\",\"H\":\"Output msg\",\"O\":[{\"M117\":\"";
-            s+= CONFIG::intTostr(FLAG_BLOCK_M117);
-            s+= "\"}";
-#ifdef ESP_OLED_FEATURE
-            s+=",{\"Oled\":\"";
-            s+= CONFIG::intTostr(FLAG_BLOCK_OLED);
-            s+="\"}";
-#endif
-            s+=",{\"Serial\":\"";
-            s+= CONFIG::intTostr(FLAG_BLOCK_SERIAL);
-            s+="\"}";
-#ifdef WS_DATA_FEATURE
-            s+=",{\"Web Socket\":\"";
-            s+= CONFIG::intTostr(FLAG_BLOCK_WSOCKET);
-            s+="\"}";
-#endif
-#ifdef TCP_IP_DATA_FEATURE
-            s+=",{\"TCP\":\"";
-            s+= CONFIG::intTostr(FLAG_BLOCK_TCP);
-            s+="\"}";
-#endif
-            s+= "]}";
-            ESPCOM::print (s, output, espresponse);
-
-#ifdef DHT_FEATURE
-
-            //DHT type
-            ESPCOM::println (F (","), output, espresponse);
-            ESPCOM::print (F ("{\"F\":\"printer\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_DHT_TYPE), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"B\",\"V\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (CONFIG::DHT_type), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"DHT Type\",\"O\":[{\"None\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (255), output, espresponse);
-            ESPCOM::print (F ("\"},{\"DHT11\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DHTesp::DHT11), output, espresponse);
-            ESPCOM::print (F ("\"},{\"DHT22\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DHTesp::DHT22), output, espresponse);
-            ESPCOM::print (F ("\"},{\"AM2302\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DHTesp::RHT03), output, espresponse);
-            ESPCOM::print (F ("\"},{\"RHT03\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DHTesp::AM2302), output, espresponse);
-            ESPCOM::print (F ("\"}]}"), output, espresponse);
-
-            //DHT interval
-            ESPCOM::println (F (","), output, espresponse);
-            ESPCOM::print (F ("{\"F\":\"printer\",\"P\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (EP_DHT_INTERVAL), output, espresponse);
-            ESPCOM::print (F ("\",\"T\":\"I\",\"V\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (CONFIG::DHT_interval), output, espresponse);
-            ESPCOM::print (F ("\",\"H\":\"DHT check (seconds)\",\"S\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (DEFAULT_MAX_WEB_PORT), output, espresponse);
-            ESPCOM::print (F ("\",\"M\":\""), output, espresponse);
-            ESPCOM::print ( (const char *) CONFIG::intTostr (0), output, espresponse);
-            ESPCOM::print (F ("\"}"), output, espresponse);
-#endif
-
-        }
-
-        //end JSON
-        ESPCOM::println (F ("\n]}"), output, espresponse);
+        CONFIG::print_settings (cmd_params.c_str(), output, espresponse);
     }
     break;
 
@@ -1595,6 +1027,67 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
         CONFIG::print_config (output, (parameter == "plain"), espresponse);
     }
     break;
+    //Get printer state cached from printer output (temperatures, position, SD, busy)
+    //or set interval of status poll when nobody else is talking to printer, 0 = no poll
+    //[ESP421]POLL=<seconds> pwd=<user/admin password>
+    case 421:
+        parameter = get_param (cmd_params, "POLL=", false);
+#ifdef AUTHENTICATION_FEATURE
+        if ((parameter.length() > 0) && (auth_type == LEVEL_GUEST)) {
+            ESPCOM::println (INCORRECT_CMD_MSG, output, espresponse);
+            response = false;
+        } else
+#endif
+        if (parameter.length() > 0) {
+            int interval = parameter.toInt();
+            if ((interval < 0) || (interval > 3600)) {
+                ESPCOM::println (INCORRECT_CMD_MSG, output, espresponse);
+                response = false;
+            } else {
+                PrinterState::setPollInterval (interval);
+                ESPCOM::println (OK_CMD_MSG, output, espresponse);
+            }
+        } else {
+            PrinterState::print (output, espresponse);
+        }
+        break;
+#ifdef MEATPACK_FEATURE
+    //Get MeatPack state of printer link with bytes before and after packing
+    //or allow/forbid packing, only Marlin is asked
+    //[ESP422]<ON/OFF> pwd=<user/admin password>
+    case 422:
+        parameter = get_param (cmd_params, "", true);
+        if (parameter.length() == 0) {
+            MeatPack::print (output, espresponse);
+        }
+#ifdef AUTHENTICATION_FEATURE
+        else if (auth_type == LEVEL_GUEST) {
+            ESPCOM::println (INCORRECT_CMD_MSG, output, espresponse);
+            response = false;
+        }
+#endif
+        else if ((parameter == "ON") || (parameter == "OFF")) {
+            MeatPack::setEnabled (parameter == "ON");
+            ESPCOM::println (OK_CMD_MSG, output, espresponse);
+        } else {
+            ESPCOM::println (INCORRECT_CMD_MSG, output, espresponse);
+            response = false;
+        }
+        break;
+#endif
+    //Get runtime metrics in Prometheus text format
+    //[ESP430] pwd=<user/admin password>
+    case 430:
+#ifdef AUTHENTICATION_FEATURE
+        if (auth_type == LEVEL_GUEST) {
+            ESPCOM::println (INCORRECT_CMD_MSG, output, espresponse);
+            response = false;
+        } else
+#endif
+        {
+            Metrics::print (output, espresponse);
+        }
+        break;
     //Set ESP mode
     //cmd is RESET, SAFEMODE, RESTART
     //[ESP444]<cmd> pwd=<admin password>
@@ -1626,7 +1119,7 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
     //[ESP500]<gcode>
     case 500: { //send GCode with check sum caching right line numbering
         //be sure serial is locked
-        if ( (web_interface->blockserial) ) {
+        if ( (web_interface->blockserial) || serial_query.active()) {
             break;
         }
         int32_t linenb = 1;
@@ -1816,7 +1309,7 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
     //[ESP700]<filename>
     case 700: { //read local file
         //be sure serial is locked
-        if ( (web_interface->blockserial) ) {
+        if ( (web_interface->blockserial) || serial_query.active()) {
             break;
         }
         cmd_params.trim() ;
@@ -1825,6 +1318,10 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
         }
         FS_FILE currentfile = SPIFFS.open (cmd_params, SPIFFS_FILE_READ);
         if (currentfile) {//if file open success
+#ifdef GCODE_MINIFIER_FEATURE
+            GcodeMinifier minifier;
+            minifier.begin (CONFIG::GetFirmwareTarget());
+#endif
             //flush to be sure send buffer is empty
             ESPCOM::flush (DEFAULT_PRINTER_PIPE);
             //until no line in file
@@ -1849,12 +1346,27 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
                             //if command is a valid number then execute command
                             if(cmd_part1.toInt()!=0) {
                                 execute_command(cmd_part1.toInt(),cmd_part2,NO_PIPE, auth_type, espresponse);
+#ifdef GCODE_MINIFIER_FEATURE
+                                //command may have sent gcode too
+                                minifier.begin (CONFIG::GetFirmwareTarget());
+#endif
                             }
                             //if not is not a valid [ESPXXX] command ignore it
                         }
                     } else {
                         //send line to serial
-                        ESPCOM::println (currentline, DEFAULT_PRINTER_PIPE);
+#ifdef GCODE_MINIFIER_FEATURE
+                        //longer lines are sent as they are
+                        if (currentline.length() < GCODE_MINIFIER_LINE_SIZE) {
+                            char compact[GCODE_MINIFIER_LINE_SIZE];
+                            if (minifier.minify (currentline.c_str(), currentline.length(), compact) > 0) {
+                                ESPCOM::println (compact, DEFAULT_PRINTER_PIPE);
+                            }
+                        } else
+#endif
+                        {
+                            ESPCOM::println (currentline, DEFAULT_PRINTER_PIPE);
+                        }
                         CONFIG::wait (1);
                         //flush to be sure send buffer is empty
                         ESPCOM::flush (DEFAULT_PRINTER_PIPE);
@@ -2031,41 +1543,46 @@ bool COMMAND::execute_command (int cmd, String cmd_params, tpipe output, level_a
         response = false;
         break;
     }
+    //settings changed by a command are saved at once, only internal batches wait
+    CONFIG::commit_settings (true);
     return response;
 }
 
-bool COMMAND::check_command (String buffer, tpipe output, bool handlelockserial, bool executecmd)
+bool COMMAND::check_command (const String & buffer, tpipe output, bool handlelockserial, bool executecmd)
+{
+    return check_command (buffer.c_str(), buffer.length(), output, handlelockserial, executecmd);
+}
+
+//buffer must be null terminated, len is its length
+bool COMMAND::check_command (const char * buffer, size_t len, tpipe output, bool handlelockserial, bool executecmd)
 {
-    String buffer2;
     LOG ("Check Command:")
     LOG (buffer)
     LOG ("\r\n")
-    bool is_temp = false;
-    if ( (buffer.indexOf ("T:") > -1 ) || (buffer.indexOf ("B:") > -1 ) ) {
-        is_temp = true;
+    response_info response;
+    ResponseClassifier::classify (buffer, len, response);
+    if (output == DEFAULT_PRINTER_PIPE) {
+        PrinterState::update (buffer, len, response);
+#ifdef MEATPACK_FEATURE
+        MeatPack::update (buffer, len);
+#endif
     }
-    if ( ( CONFIG::GetFirmwareTarget()  == REPETIER4DV) || (CONFIG::GetFirmwareTarget() == REPETIER) ) {
-        //save time no need to continue
-        if ( (buffer.indexOf ("busy:") > -1) || (buffer.startsWith ("wait") ) ) {
-            return false;
-        }
-        if (buffer.startsWith ("ok") ) {
-            return false;
-        }
-    } else  if (buffer.startsWith ("ok") && buffer.length() < 4) {
+    //save time no need to continue
+    if ((response.type == RESPONSE_BUSY) || (response.type == RESPONSE_WAIT)) {
+        return false;
+    }
+    if ((response.type == RESPONSE_ACK) && !response.temperature) {
         return false;
     }
 
 #ifdef SERIAL_COMMAND_FEATURE
     if (executecmd) {
-        String ESP_Command;
-        int ESPpos = -1;
 #ifdef MKS_TFT_FEATURE
-        if (buffer.startsWith("at+")) {
+        if (strncmp (buffer, "at+", 3) == 0) {
             //echo
             ESPCOM::print (buffer, output);
             ESPCOM::print ("\r\r\n", output);
-            if (buffer.startsWith("at+net_wanip=?")) {
+            if (strncmp (buffer, "at+net_wanip=?", 14) == 0) {
                 String ipstr;
                 if (WiFi.getMode() == WIFI_STA) {
                     ipstr = WiFi.localIP().toString() + "," + WiFi.subnetMask().toString()+ "," + WiFi.gatewayIP().toString()+"\r\n";
@@ -2073,7 +1590,7 @@ bool COMMAND::check_command (String buffer, tpipe output, bool handlelockserial,
                     ipstr = WiFi.softAPIP().toString() + ",255.255.255.0," + WiFi.softAPIP().toString()+"\r\n";
                 }
                 ESPCOM::print (ipstr, output);
-            } else if (buffer.startsWith("at+wifi_ConState=?")) {
+            } else if (strncmp (buffer, "at+wifi_ConState=?", 18) == 0) {
                 ESPCOM::print ("Connected\r\n", output);
             } else {
                 ESPCOM::print ("ok\r\n", output);
@@ -2081,40 +1598,29 @@ bool COMMAND::check_command (String buffer, tpipe output, bool handlelockserial,
             return false;
         }
 #endif
-        ESPpos = buffer.indexOf ("[ESP");
-        if (ESPpos == -1 && (CONFIG::GetFirmwareTarget() == SMOOTHIEWARE)) {
-            ESPpos = buffer.indexOf ("[esp");
-        }
-        if ((ESPpos > -1) && (ESPpos< (int)strlen("echo: " ))){
-            //is there the second part?
-            int ESPpos2 = buffer.indexOf ("]", ESPpos);
-            if (ESPpos2 > -1) {
-                //Split in command and parameters
-                String cmd_part1 = buffer.substring (ESPpos + 4, ESPpos2);
-                String cmd_part2 = "";
-                //is there space for parameters?
-                if ((uint)ESPpos2 < buffer.length() ) {
-                    cmd_part2 = buffer.substring (ESPpos2 + 1);
-                }
-                //if command is a valid number then execute command
-                if (cmd_part1.toInt() != 0) {
-                    execute_command (cmd_part1.toInt(), cmd_part2, output);
-                }
-                //if not is not a valid [ESPXXX] command
-            }
+        //if command is a valid number then execute command
+        if ((response.type == RESPONSE_ESP_COMMAND) && (response.number != 0)) {
+            //only parameters need a copy
+            String cmd_params = response.data;
+            execute_command (response.number, cmd_params, output);
         }
     }
 #endif
 
-    return is_temp;
+    return response.temperature;
 }
 
 //read a buffer in an array
 void COMMAND::read_buffer_serial (uint8_t *b, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        read_buffer_serial (b[i]);
-        //*b++;
+    while (len > 0) {
+        size_t used = buffer_serial.feed (b, len);
+        b += used;
+        len -= used;
+        //Minimum is something like M10 so 3 char
+        if (buffer_serial.ready() && (buffer_serial.length() > 3)) {
+            check_command (buffer_serial.line(), buffer_serial.length(), DEFAULT_PRINTER_PIPE);
+        }
     }
 }
 
@@ -2122,34 +1628,19 @@ void COMMAND::read_buffer_serial (uint8_t *b, size_t len)
 //read buffer as char
 void COMMAND::read_buffer_tcp (uint8_t b)
 {
-    static bool previous_was_char = false;
-    static bool iscomment = false;
-//to ensure it is continuous string, no char separated by binaries
-    if (!previous_was_char) {
-        buffer_tcp = "";
-        iscomment = false;
-    }
-//is comment ?
-    if (char (b) == ';') {
-        iscomment = true;
-    }
-//it is a char so add it to buffer
-    if (isPrintable (b) ) {
-        previous_was_char = true;
-        //add char if not a comment
-        if (!iscomment) {
-            buffer_tcp += char (b);
-        }
-    } else {
-        previous_was_char = false; //next call will reset the buffer
-    }
-//this is not printable but end of command check if need to handle it
-    if (b == 13 || b == 10) {
-        //reset comment flag
-        iscomment = false;
+    read_buffer_tcp (&b, 1);
+}
+
+//read a buffer in an array
+void COMMAND::read_buffer_tcp (uint8_t *b, size_t len)
+{
+    while (len > 0) {
+        size_t used = buffer_tcp.feed (b, len);
+        b += used;
+        len -= used;
         //Minimum is something like M10 so 3 char
-        if (buffer_tcp.length() > 3) {
-            check_command (buffer_tcp, TCP_PIPE);
+        if (buffer_tcp.ready() && (buffer_tcp.length() > 3)) {
+            check_command (buffer_tcp.line(), buffer_tcp.length(), TCP_PIPE);
         }
     }
 }
@@ -2157,33 +1648,5 @@ void COMMAND::read_buffer_tcp (uint8_t b)
 //read buffer as char
 void COMMAND::read_buffer_serial (uint8_t b)
 {
-    static bool previous_was_char = false;
-    static bool iscomment = false;
-//to ensure it is continuous string, no char separated by binaries
-    if (!previous_was_char) {
-        buffer_serial = "";
-        iscomment = false;
-    }
-//is comment ?
-    if (char (b) == ';') {
-        iscomment = true;
-    }
-//it is a char so add it to buffer
-    if (isPrintable (b) ) {
-        previous_was_char = true;
-        if (!iscomment) {
-            buffer_serial += char (b);
-        }
-    } else {
-        previous_was_char = false; //next call will reset the buffer
-    }
-//this is not printable but end of command check if need to handle it
-    if (b == 13 || b == 10) {
-        //reset comment flag
-        iscomment = false;
-        //Minimum is something like M10 so 3 char
-        if (buffer_serial.length() > 3) {
-            check_command (buffer_serial, DEFAULT_PRINTER_PIPE);
-        }
-    }
+    read_buffer_serial (&b, 1);
 }
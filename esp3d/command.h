@@ -22,23 +22,29 @@
 #define COMMAND_h
 #include <Arduino.h>
 #include "espcom.h"
+#include "line_assembler.h"
 
 
 class COMMAND
 {
 public:
-    static String buffer_serial;
-    static String buffer_tcp;
+    static LineAssembler buffer_serial;
     static void read_buffer_serial (uint8_t *b, size_t len);
     static void read_buffer_serial (uint8_t b);
 #ifdef TCP_IP_DATA_FEATURE
+    static LineAssembler buffer_tcp;
+    static void read_buffer_tcp (uint8_t *b, size_t len);
     static void read_buffer_tcp (uint8_t b);
 #endif
-    static bool check_command (String buffer, tpipe output, bool handlelockserial = true, bool executecmd = true);
+    static bool check_command (const String & buffer, tpipe output, bool handlelockserial = true, bool executecmd = true);
+    static bool check_command (const char * buffer, size_t len, tpipe output, bool handlelockserial = true, bool executecmd = true);
     static bool execute_command (int cmd, String cmd_params, tpipe output, level_authenticate_type auth_level = LEVEL_GUEST, ESPResponseStream  *espresponse = NULL);
     static String get_param (String & cmd_params, const char * id, bool withspace = false);
     static bool isadmin (String & cmd_params);
     static bool isuser (String & cmd_params);
+#ifdef AUTHENTICATION_FEATURE
+    static level_authenticate_type get_auth_level (int cmd, String & cmd_params, level_authenticate_type auth_level);
+#endif
 };
 
 #endif
@@ -36,6 +36,9 @@ extern "C" {
 #include "esp_wifi.h"
 #endif
 #include "espcom.h"
+#include "response_classifier.h"
+#include "json_writer.h"
+#include "metrics.h"
 #ifdef TIMESTAMP_FEATURE
 #include <time.h>
 #endif
@@ -83,6 +86,8 @@ bool CONFIG::SetFirmwareTarget (uint8_t fw)
 {
     if ( fw <= MAX_FW_ID) {
         FirmwareTarget = fw;
+        //printer answers depend on firmware
+        ResponseClassifier::setFirmware (fw);
         return true;
     } else {
         return false;
@@ -224,14 +229,11 @@ bool CONFIG::InitBaudrate(long value)
     }
 #endif
 
-//only Serial for ESP8266
-#ifdef ARDUINO_ARCH_ESP8266
-    Serial.setRxBufferSize (SERIAL_RX_BUFFER_SIZE);
-#endif
-
+    ESPCOM::configureSerialRx (baud_rate);
     wifi_config.baud_rate = baud_rate;
     delay (100);
     CONFIG::is_com_enabled = true;
+    ESPCOM::beginSerialTask();
     return true;
 }
 
@@ -252,6 +254,8 @@ bool CONFIG::InitExternalPorts()
 void CONFIG::esp_restart (bool async)
 {
     LOG ("Restarting\r\n")
+    //pending settings must be saved
+    commit_settings (true);
     ESPCOM::flush (DEFAULT_PRINTER_PIPE);
     SPIFFS.end();
     if (!async) {
@@ -526,6 +530,57 @@ char * CONFIG::mac2str (uint8_t mac [WL_MAC_ADDR_LENGTH])
 }
 
 
+//settings image stays in RAM once loaded, writes only change it
+//and flash is updated once no more write happened for SETTINGS_COMMIT_DELAY
+static bool settings_loaded = false;
+static bool settings_dirty = false;
+static uint32_t settings_last_write = 0;
+
+static void open_settings()
+{
+    if (!settings_loaded) {
+        EEPROM.begin (EEPROM_SIZE);
+        settings_loaded = true;
+    }
+}
+
+static void write_setting (int pos, byte value)
+{
+    //no need to wear flash if nothing changed
+    if (EEPROM.read (pos) != value) {
+        EEPROM.write (pos, value);
+        settings_dirty = true;
+    }
+    settings_last_write = millis();
+}
+
+//CRC16-CCITT of image without the CRC itself
+static uint16_t settings_crc()
+{
+    uint16_t crc = 0xFFFF;
+    for (int pos = 0; pos < EEPROM_SIZE; pos++) {
+        if ((pos == EP_SETTINGS_CRC) || (pos == EP_SETTINGS_CRC + 1)) {
+            continue;
+        }
+        crc ^= (uint16_t) EEPROM.read (pos) << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+//image in flash is the one saved, changes not saved yet are not checked
+static bool settings_valid()
+{
+    open_settings();
+    if (settings_dirty) {
+        return true;
+    }
+    uint16_t crc = EEPROM.read (EP_SETTINGS_CRC) | (EEPROM.read (EP_SETTINGS_CRC + 1) << 8);
+    return crc == settings_crc();
+}
+
 bool CONFIG::set_EEPROM_version(uint8_t v)
 {
     byte byte_buffer[6];
@@ -546,6 +601,10 @@ uint8_t CONFIG::get_EEPROM_version()
         return EEPROM_V0;
     }
     if ((byte_buffer[0]=='E') && (byte_buffer[1]=='S') && (byte_buffer[2]=='P')&& (byte_buffer[3]=='3') && (byte_buffer[4]=='D')) {
+        //a save cut by a power loss leaves a damaged image
+        if ((byte_buffer[5] >= EEPROM_V3) && !settings_valid()) {
+            return EEPROM_V0;
+        }
         return byte_buffer[5];
     }
 
@@ -565,6 +624,10 @@ bool CONFIG::adjust_EEPROM_settings()
     if (v == EEPROM_CURRENT_VERSION) {
         return true;
     }
+    //only settings crc was added
+    if (v == EEPROM_V2) {
+        bdone =true;
+    }
     if (v == 1) {
         bdone =true;
 #ifdef SDCARD_FEATURE
@@ -591,6 +654,25 @@ bool CONFIG::adjust_EEPROM_settings()
     return bdone;
 }
 
+//save changes to flash, if now is false only when writes are done
+void CONFIG::commit_settings (bool now)
+{
+    if (!settings_dirty) {
+        return;
+    }
+    if (!now && ((millis() - settings_last_write) < SETTINGS_COMMIT_DELAY)) {
+        return;
+    }
+    uint16_t crc = settings_crc();
+    EEPROM.write (EP_SETTINGS_CRC, crc & 0xFF);
+    EEPROM.write (EP_SETTINGS_CRC + 1, crc >> 8);
+    if (!EEPROM.commit() ) {
+        LOG ("Error commit settings\r\n")
+    }
+    Metrics::add (METRIC_EEPROM_COMMITS);
+    settings_dirty = false;
+}
+
 //read a string
 //a string is multibyte + \0, this is won't work if 1 char is multibyte like chinese char
 bool CONFIG::read_string (int pos, char byte_buffer[], int size_max)
@@ -600,7 +682,7 @@ bool CONFIG::read_string (int pos, char byte_buffer[], int size_max)
         LOG ("Error read string\r\n")
         return false;
     }
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     byte b = 13; // non zero for the while loop below
     int i = 0;
 
@@ -615,7 +697,6 @@ bool CONFIG::read_string (int pos, char byte_buffer[], int size_max)
     if (b != 0) {
         byte_buffer[i - 1] = 0x00;
     }
-    EEPROM.end();
 
     return true;
 }
@@ -631,7 +712,7 @@ bool CONFIG::read_string (int pos, String & sbuffer, int size_max)
     int i = 0;
     sbuffer = "";
 
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     //read until max size is reached or \0 is found
     while (i < size_max && b != 0) {
         b = EEPROM.read (pos + i);
@@ -640,7 +721,6 @@ bool CONFIG::read_string (int pos, String & sbuffer, int size_max)
         }
         i++;
     }
-    EEPROM.end();
 
     return true;
 }
@@ -654,13 +734,12 @@ bool CONFIG::read_buffer (int pos, byte byte_buffer[], int size_buffer)
         return false;
     }
     int i = 0;
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     //read until max size is reached
     while (i < size_buffer ) {
         byte_buffer[i] = EEPROM.read (pos + i);
         i++;
     }
-    EEPROM.end();
     return true;
 }
 
@@ -672,9 +751,8 @@ bool CONFIG::read_byte (int pos, byte * value)
         LOG ("Error read byte\r\n")
         return false;
     }
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     value[0] = EEPROM.read (pos);
-    EEPROM.end();
     return true;
 }
 
@@ -728,22 +806,22 @@ bool CONFIG::write_string (int pos, const char * byte_buffer)
         return false;
     }
 
-    if (!((pos == EP_STA_PASSWORD) || (pos == EP_AP_PASSWORD))) {
+    //passwords and notification settings can be empty
+    bool can_be_empty = (pos == EP_STA_PASSWORD) || (pos == EP_AP_PASSWORD) || (pos == ESP_NOTIFICATION_TOKEN1) || (pos == ESP_NOTIFICATION_TOKEN2) || (pos == ESP_NOTIFICATION_SETTINGS);
+    if (!can_be_empty) {
         if((size_buffer == 0 ) || (byte_buffer == NULL )) {
             LOG ("Error write string\r\n")
             return false;
         }
     }
     //copy the value(s)
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     for (int i = 0; i < size_buffer; i++) {
-        EEPROM.write (pos + i, byte_buffer[i]);
+        write_setting (pos + i, byte_buffer[i]);
     }
 
     //0 terminal
-    EEPROM.write (pos + size_buffer, 0x00);
-    EEPROM.commit();
-    EEPROM.end();
+    write_setting (pos + size_buffer, 0x00);
     return true;
 }
 
@@ -755,13 +833,11 @@ bool CONFIG::write_buffer (int pos, const byte * byte_buffer, int size_buffer)
         LOG ("Error write buffer\r\n")
         return false;
     }
-    EEPROM.begin (EEPROM_SIZE);
+    open_settings();
     //copy the value(s)
     for (int i = 0; i < size_buffer; i++) {
-        EEPROM.write (pos + i, byte_buffer[i]);
+        write_setting (pos + i, byte_buffer[i]);
     }
-    EEPROM.commit();
-    EEPROM.end();
     return true;
 }
 
@@ -773,10 +849,8 @@ bool CONFIG::write_byte (int pos, const byte value)
         LOG ("Error write byte\r\n")
         return false;
     }
-    EEPROM.begin (EEPROM_SIZE);
-    EEPROM.write (pos, value);
-    EEPROM.commit();
-    EEPROM.end();
+    open_settings();
+    write_setting (pos, value);
     return true;
 }
 
@@ -919,6 +993,386 @@ bool CONFIG::reset_config()
     return set_EEPROM_version(EEPROM_CURRENT_VERSION);
 }
 
+#ifndef USE_AS_UPDATER_ONLY
+//[ESP400] settings description//////////////////////////////////////////
+//labels and tables stay in flash, entries are copied one by one when used
+
+//value is never sent
+#define SETTING_SECRET      1
+//byte value is signed
+#define SETTING_SIGNED      2
+//has max (S) and min (M) sizes, after label
+#define SETTING_LIMITS      4
+//has max (S) and min (M) sizes, max before label
+#define SETTING_LIMITS_FIRST    8
+//options are all values from min to max
+#define SETTING_RANGE       16
+
+#define SETTINGS_NETWORK    0
+#define SETTINGS_PRINTER    1
+
+typedef struct {
+    const char * label;
+    int value;
+} setting_option;
+
+typedef struct {
+    uint8_t group;
+    uint16_t pos;
+    char type;
+    uint8_t flags;
+    const char * label;
+    int min;
+    int max;
+    const setting_option * options;
+    uint8_t options_count;
+} setting_description;
+
+#define SETTING_OPTIONS(o) o, sizeof(o) / sizeof(setting_option)
+#define SETTING_NO_OPTIONS NULL, 0
+
+static const char S_NONE[] PROGMEM = "None";
+static const char S_NO[] PROGMEM = "No";
+static const char S_YES[] PROGMEM = "Yes";
+static const char S_DHCP[] PROGMEM = "DHCP";
+static const char S_STATIC[] PROGMEM = "Static";
+static const char S_11B[] PROGMEM = "11b";
+static const char S_11G[] PROGMEM = "11g";
+static const char S_11N[] PROGMEM = "11n";
+
+static const char S_9600[] PROGMEM = "9600";
+static const char S_19200[] PROGMEM = "19200";
+static const char S_38400[] PROGMEM = "38400";
+static const char S_57600[] PROGMEM = "57600";
+static const char S_115200[] PROGMEM = "115200";
+static const char S_230400[] PROGMEM = "230400";
+static const char S_250000[] PROGMEM = "250000";
+static const char S_500000[] PROGMEM = "500000";
+static const char S_921600[] PROGMEM = "921600";
+static const setting_option baud_rate_options[] PROGMEM = {
+    {S_9600, 9600}, {S_19200, 19200}, {S_38400, 38400}, {S_57600, 57600}, {S_115200, 115200},
+    {S_230400, 230400}, {S_250000, 250000}, {S_500000, 500000}, {S_921600, 921600}
+};
+
+static const char S_LIGHT[] PROGMEM = "Light";
+static const char S_MODEM[] PROGMEM = "Modem";
+static const setting_option sleep_mode_options[] PROGMEM = {
+    {S_NONE, WIFI_NONE_SLEEP}, {S_LIGHT, WIFI_LIGHT_SLEEP}, {S_MODEM, WIFI_MODEM_SLEEP}
+};
+
+static const char S_AP[] PROGMEM = "AP";
+static const char S_STA[] PROGMEM = "STA";
+static const setting_option wifi_mode_options[] PROGMEM = {
+    {S_AP, 1}, {S_STA, 2}
+};
+
+static const setting_option sta_phy_mode_options[] PROGMEM = {
+    {S_11B, WIFI_PHY_MODE_11B}, {S_11G, WIFI_PHY_MODE_11G}, {S_11N, WIFI_PHY_MODE_11N}
+};
+
+static const setting_option ap_phy_mode_options[] PROGMEM = {
+    {S_11B, WIFI_PHY_MODE_11B}, {S_11G, WIFI_PHY_MODE_11G}
+};
+
+static const setting_option ip_mode_options[] PROGMEM = {
+    {S_DHCP, 1}, {S_STATIC, 2}
+};
+
+static const setting_option yes_no_options[] PROGMEM = {
+    {S_NO, 0}, {S_YES, 1}
+};
+
+static const char S_OPEN[] PROGMEM = "Open";
+static const char S_WPA[] PROGMEM = "WPA";
+static const char S_WPA2[] PROGMEM = "WPA2";
+static const char S_WPA_WPA2[] PROGMEM = "WPA/WPA2";
+static const setting_option auth_type_options[] PROGMEM = {
+    {S_OPEN, AUTH_OPEN}, {S_WPA, AUTH_WPA_PSK}, {S_WPA2, AUTH_WPA2_PSK}, {S_WPA_WPA2, AUTH_WPA_WPA2_PSK}
+};
+
+#ifdef NOTIFICATION_FEATURE
+static const char S_PUSHOVER[] PROGMEM = "Pushover";
+static const char S_EMAIL[] PROGMEM = "Email";
+static const char S_LINE[] PROGMEM = "Line";
+static const char S_IFTTT[] PROGMEM = "IFTTT";
+static const setting_option notification_options[] PROGMEM = {
+    {S_NONE, 0}, {S_PUSHOVER, ESP_PUSHOVER_NOTIFICATION}, {S_EMAIL, ESP_EMAIL_NOTIFICATION},
+    {S_LINE, ESP_LINE_NOTIFICATION}, {S_IFTTT, ESP_IFTTT_NOTIFICATION}
+};
+#endif
+
+static const char S_REPETIER[] PROGMEM = "Repetier";
+static const char S_REPETIER4DV[] PROGMEM = "Repetier for Davinci";
+static const char S_MARLIN[] PROGMEM = "Marlin";
+static const char S_MARLINKIMBRA[] PROGMEM = "Marlin Kimbra";
+static const char S_SMOOTHIEWARE[] PROGMEM = "Smoothieware";
+static const char S_GRBL[] PROGMEM = "Grbl";
+static const char S_UNKNOWN[] PROGMEM = "Unknown";
+static const setting_option target_fw_options[] PROGMEM = {
+    {S_REPETIER, REPETIER}, {S_REPETIER4DV, REPETIER4DV}, {S_MARLIN, MARLIN}, {S_MARLINKIMBRA, MARLINKIMBRA},
+    {S_SMOOTHIEWARE, SMOOTHIEWARE}, {S_GRBL, GRBL}, {S_UNKNOWN, UNKNOWN_FW}
+};
+
+static const char S_M117[] PROGMEM = "M117";
+#ifdef ESP_OLED_FEATURE
+static const char S_OLED[] PROGMEM = "Oled";
+#endif
+static const char S_SERIAL[] PROGMEM = "Serial";
+#ifdef WS_DATA_FEATURE
+static const char S_WEB_SOCKET[] PROGMEM = "Web Socket";
+#endif
+#ifdef TCP_IP_DATA_FEATURE
+static const char S_TCP[] PROGMEM = "TCP";
+#endif
+static const setting_option output_flag_options[] PROGMEM = {
+    {S_M117, FLAG_BLOCK_M117},
+#ifdef ESP_OLED_FEATURE
+    {S_OLED, FLAG_BLOCK_OLED},
+#endif
+    {S_SERIAL, FLAG_BLOCK_SERIAL},
+#ifdef WS_DATA_FEATURE
+    {S_WEB_SOCKET, FLAG_BLOCK_WSOCKET},
+#endif
+#ifdef TCP_IP_DATA_FEATURE
+    {S_TCP, FLAG_BLOCK_TCP},
+#endif
+};
+
+#ifdef DHT_FEATURE
+static const char S_DHT11[] PROGMEM = "DHT11";
+static const char S_DHT22[] PROGMEM = "DHT22";
+static const char S_AM2302[] PROGMEM = "AM2302";
+static const char S_RHT03[] PROGMEM = "RHT03";
+static const setting_option dht_type_options[] PROGMEM = {
+    {S_NONE, 255}, {S_DHT11, DHTesp::DHT11}, {S_DHT22, DHTesp::DHT22},
+    {S_AM2302, DHTesp::RHT03}, {S_RHT03, DHTesp::AM2302}
+};
+#endif
+
+static const char H_BAUD_RATE[] PROGMEM = "Baud Rate";
+static const char H_SLEEP_MODE[] PROGMEM = "Sleep Mode";
+static const char H_WEB_PORT[] PROGMEM = "Web Port";
+static const char H_DATA_PORT[] PROGMEM = "Data Port";
+#ifdef AUTHENTICATION_FEATURE
+static const char H_ADMIN_PWD[] PROGMEM = "Admin Password";
+static const char H_USER_PWD[] PROGMEM = "User Password";
+#endif
+static const char H_HOSTNAME[] PROGMEM = "Hostname";
+static const char H_WIFI_MODE[] PROGMEM = "Wifi mode";
+static const char H_STA_SSID[] PROGMEM = "Station SSID";
+static const char H_STA_PASSWORD[] PROGMEM = "Station Password";
+static const char H_STA_PHY_MODE[] PROGMEM = "Station Network Mode";
+static const char H_STA_IP_MODE[] PROGMEM = "Station IP Mode";
+static const char H_STA_IP[] PROGMEM = "Station Static IP";
+static const char H_STA_MASK[] PROGMEM = "Station Static Mask";
+static const char H_STA_GATEWAY[] PROGMEM = "Station Static Gateway";
+static const char H_AP_SSID[] PROGMEM = "AP SSID";
+static const char H_AP_PASSWORD[] PROGMEM = "AP Password";
+static const char H_AP_PHY_MODE[] PROGMEM = "AP Network Mode";
+static const char H_SSID_VISIBLE[] PROGMEM = "SSID Visible";
+static const char H_CHANNEL[] PROGMEM = "AP Channel";
+static const char H_AUTH_TYPE[] PROGMEM = "Authentication";
+static const char H_AP_IP_MODE[] PROGMEM = "AP IP Mode";
+static const char H_AP_IP[] PROGMEM = "AP Static IP";
+static const char H_AP_MASK[] PROGMEM = "AP Static Mask";
+static const char H_AP_GATEWAY[] PROGMEM = "AP Static Gateway";
+#if defined(TIMESTAMP_FEATURE)
+static const char H_TIMEZONE[] PROGMEM = "Time Zone";
+static const char H_TIME_ISDST[] PROGMEM = "Day Saving Time";
+static const char H_TIME_SERVER1[] PROGMEM = "Time Server 1";
+static const char H_TIME_SERVER2[] PROGMEM = "Time Server 2";
+static const char H_TIME_SERVER3[] PROGMEM = "Time Server 3";
+#endif
+#ifdef NOTIFICATION_FEATURE
+static const char H_NOTIFICATION_TYPE[] PROGMEM = "Notification";
+static const char H_NOTIFICATION_TOKEN1[] PROGMEM = "Token 1";
+static const char H_NOTIFICATION_TOKEN2[] PROGMEM = "Token 2";
+static const char H_NOTIFICATION_SETTINGS[] PROGMEM = "Notifications Settings";
+static const char H_AUTO_NOTIFICATION[] PROGMEM = "Auto notification";
+#endif
+static const char H_TARGET_FW[] PROGMEM = "Target FW";
+static const char H_OUTPUT_FLAG[] PROGMEM = "Output msg";
+#ifdef DHT_FEATURE
+static const char H_DHT_TYPE[] PROGMEM = "DHT Type";
+static const char H_DHT_INTERVAL[] PROGMEM = "DHT check (seconds)";
+#endif
+
+//in [ESP400] order
+static const setting_description settings_description[] PROGMEM = {
+    {SETTINGS_NETWORK, EP_BAUD_RATE, 'I', 0, H_BAUD_RATE, 0, 0, SETTING_OPTIONS(baud_rate_options)},
+    {SETTINGS_NETWORK, EP_SLEEP_MODE, 'B', 0, H_SLEEP_MODE, 0, 0, SETTING_OPTIONS(sleep_mode_options)},
+    {SETTINGS_NETWORK, EP_WEB_PORT, 'I', SETTING_LIMITS, H_WEB_PORT, DEFAULT_MIN_WEB_PORT, DEFAULT_MAX_WEB_PORT, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_DATA_PORT, 'I', SETTING_LIMITS, H_DATA_PORT, DEFAULT_MIN_DATA_PORT, DEFAULT_MAX_DATA_PORT, SETTING_NO_OPTIONS},
+#ifdef AUTHENTICATION_FEATURE
+    {SETTINGS_NETWORK, EP_ADMIN_PWD, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_ADMIN_PWD, MIN_LOCAL_PASSWORD_LENGTH, MAX_LOCAL_PASSWORD_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_USER_PWD, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_USER_PWD, MIN_LOCAL_PASSWORD_LENGTH, MAX_LOCAL_PASSWORD_LENGTH, SETTING_NO_OPTIONS},
+#endif
+    {SETTINGS_NETWORK, EP_HOSTNAME, 'S', SETTING_LIMITS, H_HOSTNAME, MIN_HOSTNAME_LENGTH, MAX_HOSTNAME_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_WIFI_MODE, 'B', 0, H_WIFI_MODE, 0, 0, SETTING_OPTIONS(wifi_mode_options)},
+    {SETTINGS_NETWORK, EP_STA_SSID, 'S', SETTING_LIMITS_FIRST, H_STA_SSID, MIN_SSID_LENGTH, MAX_SSID_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_STA_PASSWORD, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_STA_PASSWORD, MIN_PASSWORD_LENGTH, MAX_PASSWORD_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_STA_PHY_MODE, 'B', 0, H_STA_PHY_MODE, 0, 0, SETTING_OPTIONS(sta_phy_mode_options)},
+    {SETTINGS_NETWORK, EP_STA_IP_MODE, 'B', 0, H_STA_IP_MODE, 0, 0, SETTING_OPTIONS(ip_mode_options)},
+    {SETTINGS_NETWORK, EP_STA_IP_VALUE, 'A', 0, H_STA_IP, 0, 0, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_STA_MASK_VALUE, 'A', 0, H_STA_MASK, 0, 0, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_STA_GATEWAY_VALUE, 'A', 0, H_STA_GATEWAY, 0, 0, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AP_SSID, 'S', SETTING_LIMITS_FIRST, H_AP_SSID, MIN_SSID_LENGTH, MAX_SSID_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AP_PASSWORD, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_AP_PASSWORD, MIN_PASSWORD_LENGTH, MAX_PASSWORD_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AP_PHY_MODE, 'B', 0, H_AP_PHY_MODE, 0, 0, SETTING_OPTIONS(ap_phy_mode_options)},
+    {SETTINGS_NETWORK, EP_SSID_VISIBLE, 'B', 0, H_SSID_VISIBLE, 0, 0, SETTING_OPTIONS(yes_no_options)},
+    {SETTINGS_NETWORK, EP_CHANNEL, 'B', SETTING_RANGE, H_CHANNEL, 1, 11, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AUTH_TYPE, 'B', 0, H_AUTH_TYPE, 0, 0, SETTING_OPTIONS(auth_type_options)},
+    {SETTINGS_NETWORK, EP_AP_IP_MODE, 'B', 0, H_AP_IP_MODE, 0, 0, SETTING_OPTIONS(ip_mode_options)},
+    {SETTINGS_NETWORK, EP_AP_IP_VALUE, 'A', 0, H_AP_IP, 0, 0, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AP_MASK_VALUE, 'A', 0, H_AP_MASK, 0, 0, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_AP_GATEWAY_VALUE, 'A', 0, H_AP_GATEWAY, 0, 0, SETTING_NO_OPTIONS},
+#if defined(TIMESTAMP_FEATURE)
+    {SETTINGS_NETWORK, EP_TIMEZONE, 'B', SETTING_SIGNED | SETTING_RANGE, H_TIMEZONE, -12, 12, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_TIME_ISDST, 'B', 0, H_TIME_ISDST, 0, 0, SETTING_OPTIONS(yes_no_options)},
+    {SETTINGS_NETWORK, EP_TIME_SERVER1, 'S', SETTING_LIMITS_FIRST, H_TIME_SERVER1, MIN_DATA_LENGTH, MAX_DATA_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_TIME_SERVER2, 'S', SETTING_LIMITS_FIRST, H_TIME_SERVER2, MIN_DATA_LENGTH, MAX_DATA_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, EP_TIME_SERVER3, 'S', SETTING_LIMITS_FIRST, H_TIME_SERVER3, MIN_DATA_LENGTH, MAX_DATA_LENGTH, SETTING_NO_OPTIONS},
+#endif
+#ifdef NOTIFICATION_FEATURE
+    {SETTINGS_NETWORK, ESP_NOTIFICATION_TYPE, 'B', 0, H_NOTIFICATION_TYPE, 0, 0, SETTING_OPTIONS(notification_options)},
+    {SETTINGS_NETWORK, ESP_NOTIFICATION_TOKEN1, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_NOTIFICATION_TOKEN1, MIN_NOTIFICATION_TOKEN_LENGTH, MAX_NOTIFICATION_TOKEN_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, ESP_NOTIFICATION_TOKEN2, 'S', SETTING_SECRET | SETTING_LIMITS_FIRST, H_NOTIFICATION_TOKEN2, MIN_NOTIFICATION_TOKEN_LENGTH, MAX_NOTIFICATION_TOKEN_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, ESP_NOTIFICATION_SETTINGS, 'S', SETTING_LIMITS_FIRST, H_NOTIFICATION_SETTINGS, MIN_NOTIFICATION_SETTINGS_LENGTH, MAX_NOTIFICATION_SETTINGS_LENGTH, SETTING_NO_OPTIONS},
+    {SETTINGS_NETWORK, ESP_AUTO_NOTIFICATION, 'B', 0, H_AUTO_NOTIFICATION, 0, 0, SETTING_OPTIONS(yes_no_options)},
+#endif
+    {SETTINGS_PRINTER, EP_TARGET_FW, 'B', 0, H_TARGET_FW, 0, 0, SETTING_OPTIONS(target_fw_options)},
+    {SETTINGS_PRINTER, EP_OUTPUT_FLAG, 'F', 0, H_OUTPUT_FLAG, 0, 0, SETTING_OPTIONS(output_flag_options)},
+#ifdef DHT_FEATURE
+    {SETTINGS_PRINTER, EP_DHT_TYPE, 'B', 0, H_DHT_TYPE, 0, 0, SETTING_OPTIONS(dht_type_options)},
+    {SETTINGS_PRINTER, EP_DHT_INTERVAL, 'I', SETTING_LIMITS, H_DHT_INTERVAL, 0, DEFAULT_MAX_WEB_PORT, SETTING_NO_OPTIONS},
+#endif
+};
+
+static void print_setting_option (JsonWriter & writer, const __FlashStringHelper * label, int value)
+{
+    writer.print (F ("{\""));
+    writer.print (label);
+    writer.print (F ("\":\""));
+    writer.print (value);
+    writer.print (F ("\"}"));
+}
+
+static void print_setting_value (JsonWriter & writer, const setting_description & setting)
+{
+    char sbuf[MAX_DATA_LENGTH + 1];
+    byte bbuf = 0;
+    int ibuf = 0;
+    uint8_t ipbuf[4];
+    switch (setting.type) {
+    case 'B':
+    case 'F':
+        if (!CONFIG::read_byte (setting.pos, &bbuf ) ) {
+            writer.print ("???");
+        } else if (setting.flags & SETTING_SIGNED) {
+            writer.print ((int8_t) bbuf);
+        } else {
+            writer.print (bbuf);
+        }
+        break;
+    case 'I':
+        if (!CONFIG::read_buffer (setting.pos,  (byte *) &ibuf, INTEGER_LENGTH) ) {
+            writer.print ("???");
+        } else {
+            writer.print (ibuf);
+        }
+        break;
+    case 'S':
+        if (!CONFIG::read_string (setting.pos, sbuf, setting.max) ) {
+            writer.print ("???");
+        } else if (setting.flags & SETTING_SECRET) {
+            writer.print ("********");
+        } else {
+            writer.printEncoded (sbuf);
+        }
+        break;
+    case 'A':
+        if (!CONFIG::read_buffer (setting.pos, (byte *) ipbuf, IP_LENGTH) ) {
+            writer.print ("???");
+        } else {
+            writer.print (IPAddress (ipbuf).toString().c_str());
+        }
+        break;
+    }
+}
+
+//filter is network, printer or empty for all
+void CONFIG::print_settings (const char * filter, tpipe output, ESPResponseStream  *espresponse)
+{
+    bool network = (strlen (filter) == 0) || (strcmp (filter, "network") == 0);
+    bool printer = (strlen (filter) == 0) || (strcmp (filter, "printer") == 0);
+    bool first = true;
+    JsonWriter writer (output, espresponse);
+    //Start JSON
+    writer.println (F ("{\"EEPROM\":["));
+    for (size_t i = 0; i < (sizeof (settings_description) / sizeof (setting_description)); i++) {
+        setting_description setting;
+        memcpy_P (&setting, &settings_description[i], sizeof (setting_description));
+        if (!((setting.group == SETTINGS_NETWORK) ? network : printer)) {
+            continue;
+        }
+        if (!first) {
+            writer.println (F (","));
+        }
+        first = false;
+        writer.print ((setting.group == SETTINGS_NETWORK) ? F ("{\"F\":\"network\",\"P\":\"") : F ("{\"F\":\"printer\",\"P\":\""));
+        writer.print (setting.pos);
+        writer.print (F ("\",\"T\":\""));
+        char type[2] = {setting.type, '\0'};
+        writer.print (type);
+        writer.print (F ("\",\"V\":\""));
+        print_setting_value (writer, setting);
+        if (setting.flags & SETTING_LIMITS_FIRST) {
+            writer.print (F ("\",\"S\":\""));
+            writer.print (setting.max);
+        }
+        writer.print (F ("\",\"H\":\""));
+        writer.print (FPSTR (setting.label));
+        if (setting.flags & (SETTING_LIMITS | SETTING_LIMITS_FIRST)) {
+            if (setting.flags & SETTING_LIMITS) {
+                writer.print (F ("\",\"S\":\""));
+                writer.print (setting.max);
+            }
+            writer.print (F ("\",\"M\":\""));
+            writer.print (setting.min);
+            writer.print (F ("\"}"));
+        } else if (setting.options || (setting.flags & SETTING_RANGE)) {
+            writer.print (F ("\",\"O\":["));
+            if (setting.flags & SETTING_RANGE) {
+                for (int v = setting.min; v <= setting.max; v++) {
+                    writer.print (F ("{\""));
+                    writer.print (v);
+                    writer.print (F ("\":\""));
+                    writer.print (v);
+                    writer.print (F ("\"}"));
+                    if (v < setting.max) {
+                        writer.print (F (","));
+                    }
+                }
+            } else {
+                for (uint8_t o = 0; o < setting.options_count; o++) {
+                    setting_option option;
+                    memcpy_P (&option, &setting.options[o], sizeof (setting_option));
+                    print_setting_option (writer, FPSTR (option.label), option.value);
+                    if (o < (setting.options_count - 1)) {
+                        writer.print (F (","));
+                    }
+                }
+            }
+            writer.print (F ("]}"));
+        } else {
+            writer.print (F ("\"}"));
+        }
+    }
+    //end JSON
+    writer.println (F ("\n]}"));
+}
+#endif //USE_AS_UPDATER_ONLY
+
 void CONFIG::print_config (tpipe output, bool plaintext, ESPResponseStream  *espresponse)
 {
     if (!plaintext) {
@@ -1982,9 +2436,7 @@ void CONFIG::print_config (tpipe output, bool plaintext, ESPResponseStream  *esp
 
 #ifdef DEBUG_OUTPUT_SOCKET
 #if defined(ARDUINO_ARCH_ESP8266)
-#define NODEBUG_WEBSOCKETS
-#include <WebSocketsServer.h>
-extern WebSocketsServer * socket_server;
+#include "syncwebserver.h"
 const char * pathToFileName(const char * path)
 {
     size_t i = 0;
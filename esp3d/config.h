@@ -91,6 +91,21 @@
 //WS_DATA_FEATURE: allow to connect serial from Websocket
 #define WS_DATA_FEATURE
 
+//STATE_PUSH_FEATURE: push printer state and ESP health to web clients by Websocket
+#define STATE_PUSH_FEATURE
+
+//BINARY_TRANSFER_FEATURE: upload to printer SD using Marlin binary protocol (M28 B1)
+//when printer has BINARY_FILE_TRANSFER enabled, ascii upload is used otherwise
+#define BINARY_TRANSFER_FEATURE
+
+//GCODE_MINIFIER_FEATURE: make gcode lines shorter before sending them to printer
+//on SD upload and [ESP700] macros, according to what firmware accepts
+#define GCODE_MINIFIER_FEATURE
+
+//MEATPACK_FEATURE: pack all data sent to printer when Marlin has MeatPack enabled
+//printer is asked when idle, a printer without MeatPack gets one unknown command
+#define MEATPACK_FEATURE
+
 //TIMESTAMP_FEATURE: Time stamp feature on direct SD  files
 //#define TIMESTAMP_FEATURE
 #endif //USE_AS_UPDATER_ONLY
@@ -100,7 +115,35 @@
 //#define DISABLE_CONNECTING_MSG
 
 //Serial rx buffer size is 256 but can be extended
+//it is sized from baud rate to keep what printer sends during this time (ms)
+//while loop is busy, from SERIAL_RX_BUFFER_SIZE to SERIAL_RX_BUFFER_MAX
+#define SERIAL_RX_BUFFER_TIME 100
 #define SERIAL_RX_BUFFER_SIZE 512
+#ifdef ARDUINO_ARCH_ESP8266
+//heap is short on ESP8266: at most 512 bytes more than fixed size used before,
+//a loop slower than 1024 chars (~90ms at 115200) shows in esp3d_uart_rx_overruns_total
+#define SERIAL_RX_BUFFER_MAX 1024
+#else
+#define SERIAL_RX_BUFFER_MAX 8192
+#endif
+//printer output is read when line has been idle for this number of chars
+//or when a full chunk is there, so consumers get whole bursts
+#define SERIAL_RX_IDLE_CHARS 4
+
+//Serial upload: number of lines sent to printer without waiting for ok
+//use 1 to go back to send line / wait ok mode
+#define SERIAL_STREAM_WINDOW 4
+
+//Printer serial rx buffer size, serial upload never sends more bytes than this ahead
+//Marlin and Grbl use 128 bytes
+#define PRINTER_RX_BUFFER_SIZE 127
+
+//State push: minimum time between two state messages to same websocket client (ms)
+//a client which cannot take a message waits up to max interval, values are merged meanwhile
+#define STATE_PUSH_INTERVAL 250
+#define STATE_PUSH_MAX_INTERVAL 4000
+//ESP health (heap, signal, uptime) refresh (ms)
+#define STATE_PUSH_HEALTH_INTERVAL 5000
 
 //Serial Parameters
 #define ESP_SERIAL_PARAM SERIAL_8N1
@@ -112,6 +155,18 @@
 //#define USE_SERIAL_1
 //#define USE_SERIAL_2
 
+//SERIAL_TASK_FEATURE: ESP32 only, a task owns the UART and exchanges data
+//with the rest of firmware through two lock-free queues
+//#define SERIAL_TASK_FEATURE
+#if defined(SERIAL_TASK_FEATURE) && !defined(ARDUINO_ARCH_ESP32)
+#undef SERIAL_TASK_FEATURE
+#endif
+//size of each queue, must be a power of 2
+#define SERIAL_TASK_BUFFER_SIZE 1024
+#define SERIAL_TASK_STACK_SIZE 2048
+//above Arduino loop task
+#define SERIAL_TASK_PRIORITY 5
+
 //Pins Definition ////////////////////////////////////////////////////////////////////////
 //-1 means use default pins of your board what ever the serial you choose
 #define ESP_RX_PIN -1
@@ -175,7 +230,20 @@
 #endif
 
 //number of clients allowed to use data port at once
-#define MAX_SRV_CLIENTS 1
+#define MAX_SRV_CLIENTS 4
+//data port buffers of each client
+#define TCP_CLIENT_RX_SIZE 128
+#define TCP_CLIENT_TX_CHUNKS 4
+//client which started a line keeps printer until end of line or this delay (ms)
+#define TCP_LINE_TIMEOUT 1000
+
+//printer data kept for each websocket client which cannot take it yet,
+//oldest data is dropped when full and client is told how much was lost
+#define WS_CLIENT_TX_CHUNKS 4
+//websocket client which takes no data during this time is disconnected (ms)
+#define WS_CLIENT_STALL_TIMEOUT 10000
+//printer commands from websocket clients waiting for room in printer serial
+#define WS_INPUT_SIZE 512
 
 #ifdef ARDUINO_ARCH_ESP32
 #include "FS.h"
@@ -361,6 +429,7 @@ typedef enum {
 #define EP_SD_CHECK_UPDATE_AT_BOOT   854//1  bytes = flag
 #define ESP_NOTIFICATION_SETTINGS 855//128 bytes 127+1 = string  ; warning does not support multibyte char like chinese
 
+#define EP_SETTINGS_CRC 1015//2 bytes = CRC16 of all other bytes, set when settings are saved
 #define EP_EEPROM_VERSION 1017// 6 bytes = ESP3D<V on one byte>
 
 #define LAST_EEPROM_ADDRESS 983
@@ -499,6 +568,8 @@ const uint16_t Setting[][2] = {
 
 //sizes
 #define EEPROM_SIZE             1024 //max is 1024
+//delay without write before settings changes are saved to flash (ms)
+#define SETTINGS_COMMIT_DELAY   1000
 #define MAX_SSID_LENGTH             32
 #define MIN_SSID_LENGTH             1
 #define MAX_PASSWORD_LENGTH             64
@@ -519,8 +590,10 @@ const uint16_t Setting[][2] = {
 #define EEPROM_V0 0
 #define EEPROM_V1 1
 #define EEPROM_V2 2
+//same as V2 with EP_SETTINGS_CRC
+#define EEPROM_V3 3
 
-#define EEPROM_CURRENT_VERSION EEPROM_V2
+#define EEPROM_CURRENT_VERSION EEPROM_V3
 
 
 #if defined(ASYNCWEBSERVER)
@@ -563,6 +636,8 @@ public:
     static bool write_byte (int pos, const byte value);
     static bool reset_config();
     static void print_config (tpipe output, bool plaintext, ESPResponseStream  *espresponse = NULL);
+    static void print_settings (const char * filter, tpipe output, ESPResponseStream  *espresponse = NULL);
+    static void commit_settings (bool now = false);
     static bool SetFirmwareTarget (uint8_t fw);
     static void InitFirmwareTarget();
     static void InitOutput();
@@ -43,6 +43,13 @@
 #include "espcom.h"
 #include "webinterface.h"
 #include "command.h"
+#include "metrics.h"
+#include "scheduler.h"
+#include "printer_state.h"
+#include "state_push.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
 #ifdef ARDUINO_ARCH_ESP8266
 #include "ESP8266WiFi.h"
 #if defined (ASYNCWEBSERVER)
@@ -107,13 +114,16 @@ void Esp3D::begin(uint16_t startdelayms, uint16_t recoverydelayms)
     delay (2000);
     LOG ("\r\nDebug Serial set\r\n")
 #endif
-    CONFIG::adjust_EEPROM_settings();
+    bool breset_config = false;
+    //settings are damaged or unknown => reset settings
+    if (!CONFIG::adjust_EEPROM_settings()) {
+        breset_config = true;
+    }
     CONFIG::InitOutput();
 #ifdef ESP_OLED_FEATURE
     OLED_DISPLAY::begin();
     OLED_DISPLAY::splash();
 #endif
-    bool breset_config = false;
     web_interface = NULL;
 #ifdef TCP_IP_DATA_FEATURE
     data_server = NULL;
@@ -153,9 +163,6 @@ void Esp3D::begin(uint16_t startdelayms, uint16_t recoverydelayms)
     if (breset_config) {
         //update EEPROM with default settings
         CONFIG::InitBaudrate(DEFAULT_BAUD_RATE);
-#ifdef ARDUINO_ARCH_ESP8266
-        Serial.setRxBufferSize (SERIAL_RX_BUFFER_SIZE);
-#endif
         delay (2000);
         ESPCOM::println (F ("ESP EEPROM reset"), PRINTER_PIPE);
 #ifdef DEBUG_ESP3D
@@ -249,21 +256,34 @@ void Esp3D::begin(uint16_t startdelayms, uint16_t recoverydelayms)
         WiFi.scanNetworks (true);
     }
 #endif
+    add_tasks();
     LOG ("Setup Done\r\n");
 }
 
-//Process which handle all input
-void Esp3D::process()
+//Tasks run by scheduler ////////////////////////////////////////////////
+//read / bridge all input
+static void bridge_task()
 {
-#ifdef ARDUINO_ARCH_ESP8266
-#ifdef MDNS_FEATURE
-    wifi_config.mdns.update();
-#endif
-#endif
+    ESPCOM::bridge();
+}
+
 #if !defined(ASYNCWEBSERVER)
 //web requests for sync
+static void web_task()
+{
+    uint32_t web_start = micros();
     web_interface->web_server.handleClient();
+    Metrics::observe (METRIC_WEB_HANDLER_TIME, micros() - web_start);
     socket_server->loop();
+}
+#endif
+
+static void network_task()
+{
+#ifdef ARDUINO_ARCH_ESP8266
+#ifdef MDNS_FEATURE
+    wifi_config.mdns.update();
+#endif
 #endif
 //be sure wifi is on to proceed wifi function
     if ((WiFi.getMode() != WIFI_OFF)  || wifi_config.WiFi_on) {
@@ -272,50 +292,77 @@ void Esp3D::process()
             dnsServer.processNextRequest();
         }
 #endif
-        //TODO use config
-        CONFIG::wait(0);
     }
-//read / bridge all input
-    ESPCOM::bridge();
+}
+
+static void system_task()
+{
+//save settings changes if any
+    CONFIG::commit_settings();
 //in case of restart requested
     if (web_interface->restartmodule) {
         CONFIG::esp_restart();
     }
+}
+
+//free heap is not cheap to get, so it runs once per second
+static void heap_task()
+{
+    Metrics::setMin (METRIC_FREE_HEAP_MIN, ESP.getFreeHeap());
+}
+
+//ask printer status if poll is enabled by [ESP421]
+//and ask printer to unpack MeatPack if not done yet
+static void state_task()
+{
+    PrinterState::poll();
+#ifdef MEATPACK_FEATURE
+    MeatPack::poll();
+#endif
+}
+
+#ifdef STATE_PUSH_FEATURE
+//send changed state to web clients
+static void push_task()
+{
+    StatePush::process();
+}
+#endif
 
 #ifdef ESP_OLED_FEATURE
-    static uint32_t last_oled_update= 0;
+static void oled_task()
+{
     if ( !CONFIG::is_locked(FLAG_BLOCK_OLED)) {
-        uint32_t now_oled = millis();
-        if (now_oled - last_oled_update > 1000) {
-            last_oled_update = now_oled;
-            //refresh signal
-            if ((WiFi.getMode() == WIFI_OFF) || !wifi_config.WiFi_on) {
-                OLED_DISPLAY::display_signal(-1);
-            } else {
-                OLED_DISPLAY::display_signal(wifi_config.getSignal (WiFi.RSSI ()));
-            }
-            //if line 0 is > 85 refresh
-            if(OLED_DISPLAY::L0_size >85) {
-                OLED_DISPLAY::display_text(OLED_DISPLAY::L0.c_str(), 0, 0, 85);
-            }
-            //if line 1 is > 128 refresh
-            if(OLED_DISPLAY::L1_size >128) {
-                OLED_DISPLAY::display_text(OLED_DISPLAY::L1.c_str(), 0, 16, 128);
-            }
-            //if line 2 is > 128 refresh
-            if(OLED_DISPLAY::L2_size >128) {
-                OLED_DISPLAY::display_text(OLED_DISPLAY::L2.c_str(), 0, 32, 128);
-            }
-            //if line 3 is > 128 refresh
-            if(OLED_DISPLAY::L3_size >128) {
-                OLED_DISPLAY::display_text(OLED_DISPLAY::L3.c_str(), 0, 48, 128);
-            }
-            OLED_DISPLAY::update_lcd();
+        //refresh signal
+        if ((WiFi.getMode() == WIFI_OFF) || !wifi_config.WiFi_on) {
+            OLED_DISPLAY::display_signal(-1);
+        } else {
+            OLED_DISPLAY::display_signal(wifi_config.getSignal (WiFi.RSSI ()));
+        }
+        //if line 0 is > 85 refresh
+        if(OLED_DISPLAY::L0_size >85) {
+            OLED_DISPLAY::display_text(OLED_DISPLAY::L0.c_str(), 0, 0, 85);
         }
+        //if line 1 is > 128 refresh
+        if(OLED_DISPLAY::L1_size >128) {
+            OLED_DISPLAY::display_text(OLED_DISPLAY::L1.c_str(), 0, 16, 128);
+        }
+        //if line 2 is > 128 refresh
+        if(OLED_DISPLAY::L2_size >128) {
+            OLED_DISPLAY::display_text(OLED_DISPLAY::L2.c_str(), 0, 32, 128);
+        }
+        //if line 3 is > 128 refresh
+        if(OLED_DISPLAY::L3_size >128) {
+            OLED_DISPLAY::display_text(OLED_DISPLAY::L3.c_str(), 0, 48, 128);
+        }
+        OLED_DISPLAY::update_lcd();
     }
+}
 #endif
 
 #ifdef DHT_FEATURE
+static void dht_task()
+{
     if (CONFIG::DHT_type  != 255) {
         static uint32_t last_dht_update= 0;
         uint32_t now_dht = millis();
@@ -342,7 +389,55 @@ void Esp3D::process()
             }
         }
     }
+}
+#endif
+
+static const char task_bridge_name[] PROGMEM = "bridge";
+#if !defined(ASYNCWEBSERVER)
+static const char task_web_name[] PROGMEM = "web";
 #endif
+static const char task_network_name[] PROGMEM = "network";
+static const char task_system_name[] PROGMEM = "system";
+static const char task_heap_name[] PROGMEM = "heap";
+static const char task_state_name[] PROGMEM = "state";
+#ifdef STATE_PUSH_FEATURE
+static const char task_push_name[] PROGMEM = "push";
+#endif
+#ifdef ESP_OLED_FEATURE
+static const char task_oled_name[] PROGMEM = "oled";
+#endif
+#ifdef DHT_FEATURE
+static const char task_dht_name[] PROGMEM = "dht";
+#endif
+
+void Esp3D::add_tasks()
+{
+    //serial stream to printer must never starve
+    Scheduler::add (task_bridge_name, bridge_task, TASK_PRIORITY_BRIDGE);
+#if !defined(ASYNCWEBSERVER)
+    Scheduler::add (task_web_name, web_task, TASK_PRIORITY_HIGH);
+#endif
+    Scheduler::add (task_system_name, system_task, TASK_PRIORITY_HIGH);
+    Scheduler::add (task_network_name, network_task, TASK_PRIORITY_NORMAL);
+    Scheduler::add (task_heap_name, heap_task, TASK_PRIORITY_LOW, 1000);
+    Scheduler::add (task_state_name, state_task, TASK_PRIORITY_LOW, 1000);
+#ifdef STATE_PUSH_FEATURE
+    Scheduler::add (task_push_name, push_task, TASK_PRIORITY_LOW, 50);
+#endif
+#ifdef ESP_OLED_FEATURE
+    Scheduler::add (task_oled_name, oled_task, TASK_PRIORITY_LOW, 1000);
+#endif
+#ifdef DHT_FEATURE
+    Scheduler::add (task_dht_name, dht_task, TASK_PRIORITY_LOW, 1000);
+#endif
+}
+
+//Process which handle all input
+void Esp3D::process()
+{
+    uint32_t loop_start = micros();
+    Scheduler::run();
+    Metrics::observe (METRIC_LOOP_TIME, micros() - loop_start);
 //todo use config
     CONFIG::wait(0);
 }
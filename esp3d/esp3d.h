@@ -32,5 +32,7 @@ public:
     Esp3D();
     void begin(uint16_t startdelayms = 8000, uint16_t recoverydelayms = 8000);
     void process();
+private:
+    void add_tasks();
 };
 #endif
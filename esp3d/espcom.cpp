@@ -22,6 +22,17 @@
 #include "espcom.h"
 #include "command.h"
 #include "webinterface.h"
+#include "serial_query.h"
+#include "metrics.h"
+#ifdef SERIAL_TASK_FEATURE
+#include "spsc_ring.h"
+#endif
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#endif
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
 #if defined (ASYNCWEBSERVER)
 #include "asyncwebserver.h"
 #else
@@ -38,10 +49,206 @@ uint8_t  ESPCOM::current_socket_id=0;
 #ifdef TCP_IP_DATA_FEATURE
 WiFiServer * data_server;
 WiFiClient serverClients[MAX_SRV_CLIENTS];
+//rx keeps client data until it can go to printer
+//tx keeps references on printer data the client cannot take yet
+typedef struct {
+    uint8_t rx[TCP_CLIENT_RX_SIZE];
+    uint16_t rx_size;
+    uart_chunk * tx[TCP_CLIENT_TX_CHUNKS];
+    uint8_t tx_head;
+    uint8_t tx_count;
+    //bytes of first chunk already sent
+    uint16_t tx_offset;
+} tcp_client_buffer;
+static tcp_client_buffer clientBuffers[MAX_SRV_CLIENTS];
+//client currently sending a line to printer, -1 if none
+static int8_t tcp_owner = -1;
+static uint8_t tcp_last_owner = 0;
+static uint32_t tcp_owner_activity = 0;
+//line of last owner was cut, it must be ended before other data
+static bool tcp_midline = false;
+static void drop_client_chunk (uint8_t i);
+static void release_tcp_owner();
+#endif
+
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+//printer data a websocket client cannot take yet
+typedef struct {
+    uart_chunk * tx[WS_CLIENT_TX_CHUNKS];
+    uint8_t tx_head;
+    uint8_t tx_count;
+    //bytes lost since last frame sent to client
+    uint32_t dropped;
+    //since when client cannot take data, 0 if it can
+    uint32_t stalled_since;
+} ws_client_buffer;
+static ws_client_buffer wsBuffers[WEBSOCKETS_SERVER_CLIENT_MAX];
+static void drop_ws_chunk (uint8_t num);
+//complete lines from websocket clients waiting for printer
+static uint8_t ws_input[WS_INPUT_SIZE];
+static uint16_t ws_input_size = 0;
+//a websocket line is partly sent, printer is kept until its end
+static bool ws_midline = false;
+static void forward_ws();
 #endif
 
 bool ESPCOM::block_2_printer = false;
 
+#if defined(USE_SERIAL_0)
+#define ESP_SERIAL Serial
+#elif defined(USE_SERIAL_1)
+#define ESP_SERIAL Serial1
+#else
+#define ESP_SERIAL Serial2
+#endif
+//time without new printer data before it is read (us)
+static uint32_t serial_idle_us = 0;
+
+#ifdef SERIAL_TASK_FEATURE
+//printer -> ESP, serial task is producer
+static uint8_t serial_rx_buffer[SERIAL_TASK_BUFFER_SIZE];
+static SpscRing serial_rx (serial_rx_buffer, SERIAL_TASK_BUFFER_SIZE);
+//ESP -> printer, serial task is consumer
+static uint8_t serial_tx_buffer[SERIAL_TASK_BUFFER_SIZE];
+static SpscRing serial_tx (serial_tx_buffer, SERIAL_TASK_BUFFER_SIZE);
+static TaskHandle_t serial_task_handle = NULL;
+
+//only this task touches UART, so printer is fed even if loop is busy
+static void serial_task (void * parameter)
+{
+    (void)parameter;
+    uint8_t buf[64];
+    for (;;) {
+        bool idle = true;
+        size_t len = ESP_SERIAL.available();
+        if (len > serial_rx.free()) {
+            len = serial_rx.free();
+        }
+        if (len > sizeof (buf)) {
+            len = sizeof (buf);
+        }
+        if (len > 0) {
+            len = ESP_SERIAL.readBytes (buf, len);
+            serial_rx.write (buf, len);
+            idle = false;
+        }
+        len = ESP_SERIAL.availableForWrite();
+        if (len > sizeof (buf)) {
+            len = sizeof (buf);
+        }
+        len = serial_tx.read (buf, len);
+        if (len > 0) {
+            ESP_SERIAL.write (buf, len);
+            idle = false;
+        }
+        if (idle) {
+            vTaskDelay (1);
+        }
+    }
+}
+
+//wait for room in queue as a direct UART write would do
+static size_t serial_task_write (const uint8_t * data, size_t len)
+{
+    size_t sent = 0;
+    while (sent < len) {
+        sent += serial_tx.write (&data[sent], len - sent);
+        if (sent < len) {
+            vTaskDelay (1);
+        }
+    }
+    return sent;
+}
+#endif
+
+#ifdef MEATPACK_FEATURE
+//wait until all packed bytes are taken, so a packed byte
+//and the chars sent as they are after it are never split
+static size_t send_packed (const uint8_t * data, size_t len)
+{
+    uint8_t packed[64];
+    size_t done = 0;
+    while (done < len) {
+        size_t used;
+        size_t size = MeatPack::encode (&data[done], len - done, packed, sizeof (packed), used);
+        done += used;
+        Metrics::add (METRIC_UART_TX_BYTES, size);
+#ifdef SERIAL_TASK_FEATURE
+        serial_task_write (packed, size);
+#else
+        ESP_SERIAL.write (packed, size);
+#endif
+    }
+    return len;
+}
+#endif
+
+//size UART rx buffer to keep SERIAL_RX_BUFFER_TIME of data at this baud rate
+void ESPCOM::configureSerialRx (long baud_rate)
+{
+    static size_t rx_size = 0;
+    //a byte is 10 bits with start and stop bits
+    uint32_t needed = ((baud_rate / 10) * SERIAL_RX_BUFFER_TIME) / 1000;
+    size_t size = SERIAL_RX_BUFFER_SIZE;
+    while ((size < needed) && (size < SERIAL_RX_BUFFER_MAX)) {
+        size *= 2;
+    }
+    //data in buffer may be lost, so only when size changes
+    if (size != rx_size) {
+        ESP_SERIAL.setRxBufferSize (size);
+        rx_size = size;
+        Metrics::set (METRIC_UART_RX_BUFFER, size);
+    }
+    serial_idle_us = (SERIAL_RX_IDLE_CHARS * 10 * 1000000UL) / baud_rate;
+}
+
+//ESP32 core does not report UART errors
+static void check_serial_errors()
+{
+#ifdef ARDUINO_ARCH_ESP8266
+    if (ESP_SERIAL.hasOverrun()) {
+        Metrics::add (METRIC_UART_RX_OVERRUNS);
+        log_esp3d ("Serial rx overrun");
+    }
+    if (ESP_SERIAL.hasRxError()) {
+        Metrics::add (METRIC_UART_RX_ERRORS);
+        log_esp3d ("Serial rx error");
+    }
+#endif
+}
+
+//printer output is read by bursts: when a full chunk is there or when
+//nothing came during idle time, so consumers do not get it byte by byte
+static bool serial_burst_ready (size_t len)
+{
+    static size_t last_len = 0;
+    static uint32_t last_change = 0;
+    if (len >= UART_POOL_CHUNK_SIZE) {
+        last_len = 0;
+        return true;
+    }
+    if (len != last_len) {
+        last_len = len;
+        last_change = micros();
+        return false;
+    }
+    if ((micros() - last_change) < serial_idle_us) {
+        return false;
+    }
+    last_len = 0;
+    return true;
+}
+
+//start serial task if enabled, UART must be ready
+void ESPCOM::beginSerialTask()
+{
+#ifdef SERIAL_TASK_FEATURE
+    if (!serial_task_handle) {
+        xTaskCreatePinnedToCore (serial_task, "serial", SERIAL_TASK_STACK_SIZE, NULL, SERIAL_TASK_PRIORITY, &serial_task_handle, 0);
+    }
+#endif
+}
+
 void ESPCOM::bridge(bool async)
 {
 #if defined (ASYNCWEBSERVER)
@@ -54,8 +261,22 @@ void ESPCOM::bridge(bool async)
             ESPCOM::processFromTCP2Serial();
 #endif
         }
+//start queued printer commands
+        serial_query.process();
 //read serial input
-        ESPCOM::processFromSerial();
+#ifndef USE_AS_UPDATER_ONLY
+        //printer answers belong to streamer when uploading
+        if (gcode_streamer.started()) {
+            gcode_streamer.process();
+        } else
+#endif
+            ESPCOM::processFromSerial();
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+//send printer data websocket clients could not take yet
+        ESPCOM::flushWS();
+//send websocket commands to printer
+        forward_ws();
+#endif
 #if defined (ASYNCWEBSERVER)
     }
 #endif
@@ -63,6 +284,11 @@ void ESPCOM::bridge(bool async)
 
 long ESPCOM::readBytes (tpipe output, uint8_t * sbuf, size_t len)
 {
+#ifdef SERIAL_TASK_FEATURE
+    if (SERIAL_PIPE == output) {
+        return serial_rx.read (sbuf, len);
+    }
+#endif
     switch (output) {
 #ifdef USE_SERIAL_0
     case SERIAL_PIPE:{
@@ -127,6 +353,11 @@ long ESPCOM::baudRate(tpipe output)
 }
 size_t ESPCOM::available(tpipe output)
 {
+#ifdef SERIAL_TASK_FEATURE
+    if (SERIAL_PIPE == output) {
+        return serial_rx.available();
+    }
+#endif
     switch (output) {
 #ifdef USE_SERIAL_0
     case SERIAL_PIPE:
@@ -156,6 +387,17 @@ size_t   ESPCOM::write(tpipe output, uint8_t d)
     if ((SERIAL_PIPE == output) && CONFIG::is_locked(FLAG_BLOCK_SERIAL)) {
         return 0;
     }
+#ifdef MEATPACK_FEATURE
+    if ((DEFAULT_PRINTER_PIPE == output) && MeatPack::active()) {
+        return send_packed (&d, 1);
+    }
+#endif
+    if (SERIAL_PIPE == output) {
+        Metrics::add (METRIC_UART_TX_BYTES);
+#ifdef SERIAL_TASK_FEATURE
+        return serial_task_write (&d, 1);
+#endif
+    }
     switch (output) {
 #ifdef USE_SERIAL_0
     case SERIAL_PIPE:
@@ -177,8 +419,85 @@ size_t   ESPCOM::write(tpipe output, uint8_t d)
         break;
     }
 }
+size_t   ESPCOM::write(tpipe output, const uint8_t * data, size_t len)
+{
+    if ((DEFAULT_PRINTER_PIPE == output) && (block_2_printer || CONFIG::is_locked(FLAG_BLOCK_SERIAL))) {
+        return 0;
+    }
+    if ((SERIAL_PIPE == output) && CONFIG::is_locked(FLAG_BLOCK_SERIAL)) {
+        return 0;
+    }
+#ifdef MEATPACK_FEATURE
+    if ((DEFAULT_PRINTER_PIPE == output) && MeatPack::active()) {
+        return send_packed (data, len);
+    }
+#endif
+    if (SERIAL_PIPE == output) {
+        Metrics::add (METRIC_UART_TX_BYTES, len);
+#ifdef SERIAL_TASK_FEATURE
+        return serial_task_write (data, len);
+#endif
+    }
+    switch (output) {
+#ifdef USE_SERIAL_0
+    case SERIAL_PIPE:
+        return Serial.write(data, len);
+        break;
+#endif
+#ifdef USE_SERIAL_1
+    case SERIAL_PIPE:
+        return Serial1.write(data, len);
+        break;
+#endif
+#ifdef USE_SERIAL_2
+    case SERIAL_PIPE:
+        return Serial2.write(data, len);
+        break;
+#endif
+    default:
+        return 0;
+        break;
+    }
+}
+//room left in UART TX buffer
+size_t ESPCOM::availableForWrite(tpipe output)
+{
+#ifdef SERIAL_TASK_FEATURE
+    if (SERIAL_PIPE == output) {
+        return serial_tx.free();
+    }
+#endif
+    switch (output) {
+#ifdef USE_SERIAL_0
+    case SERIAL_PIPE:
+        return Serial.availableForWrite();
+        break;
+#endif
+#ifdef USE_SERIAL_1
+    case SERIAL_PIPE:
+        return Serial1.availableForWrite();
+        break;
+#endif
+#ifdef USE_SERIAL_2
+    case SERIAL_PIPE:
+        return Serial2.availableForWrite();
+        break;
+#endif
+    default:
+        return 0;
+        break;
+    }
+}
 void ESPCOM::flush (tpipe output, ESPResponseStream  *espresponse)
 {
+#ifdef SERIAL_TASK_FEATURE
+    //queue must be empty before UART can be flushed
+    if (SERIAL_PIPE == output) {
+        while (serial_tx.free() < SERIAL_TASK_BUFFER_SIZE) {
+            vTaskDelay (1);
+        }
+    }
+#endif
     switch (output) {
 #ifdef USE_SERIAL_0
     case SERIAL_PIPE:
@@ -247,6 +566,19 @@ void ESPCOM::print (const char * data, tpipe output, ESPResponseStream  *espresp
         return;
     }
 #endif
+#ifdef MEATPACK_FEATURE
+    if ((DEFAULT_PRINTER_PIPE == output) && MeatPack::active()) {
+        send_packed ((const uint8_t *)data, strlen (data));
+        return;
+    }
+#endif
+    if (SERIAL_PIPE == output) {
+        Metrics::add (METRIC_UART_TX_BYTES, strlen (data));
+#ifdef SERIAL_TASK_FEATURE
+        serial_task_write ((const uint8_t *)data, strlen (data));
+        return;
+#endif
+    }
     switch (output) {
 #ifdef USE_SERIAL_0
     case SERIAL_PIPE:
@@ -364,6 +696,219 @@ void ESPCOM::println (const char * data, tpipe output, ESPResponseStream  *espre
 }
 
 
+//chunk for new printer data, when pool is empty the oldest data
+//waiting for the most late tcp or websocket client is dropped
+static uart_chunk * get_chunk()
+{
+    uart_chunk * chunk = UartFanout::acquire();
+    while (!chunk) {
+        uint8_t late = 0;
+        uint8_t late_count = 0;
+        bool late_ws = false;
+#ifdef TCP_IP_DATA_FEATURE
+        for (uint8_t i = 0; i < MAX_SRV_CLIENTS; i++) {
+            if (clientBuffers[i].tx_count > late_count) {
+                late = i;
+                late_count = clientBuffers[i].tx_count;
+            }
+        }
+#endif
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+        for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+            if (wsBuffers[num].tx_count > late_count) {
+                late = num;
+                late_count = wsBuffers[num].tx_count;
+                late_ws = true;
+            }
+        }
+#endif
+        if (late_count == 0) {
+            break;
+        }
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+        if (late_ws) {
+            drop_ws_chunk (late);
+        }
+#endif
+#ifdef TCP_IP_DATA_FEATURE
+        if (!late_ws) {
+            drop_client_chunk (late);
+        }
+#endif
+        chunk = UartFanout::acquire();
+    }
+    return chunk;
+}
+
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+//send chunk as one frame if client can take it without waiting,
+//client is first told how much data it has lost if any
+static bool send_ws_chunk (uint8_t num, uart_chunk * chunk)
+{
+    ws_client_buffer & wb = wsBuffers[num];
+    char marker[24];
+    size_t marker_size = 0;
+    if (wb.dropped > 0) {
+        marker_size = snprintf (marker, sizeof (marker), "DROPPED:%u", (unsigned int)wb.dropped);
+    }
+    //frame header is 4 bytes for these sizes
+    if (socket_server->availableForWrite (num) < (chunk->size + 4 + ((marker_size > 0) ? marker_size + 4 : 0))) {
+        return false;
+    }
+    if (marker_size > 0) {
+        socket_server->sendTXT (num, marker, marker_size);
+        wb.dropped = 0;
+    }
+    //a failed send means client is gone, data is done anyway
+    if (socket_server->sendBIN (num, chunk->data, chunk->size)) {
+        UartFanout::count (FANOUT_WEBSOCKET, chunk->size);
+    } else {
+        UartFanout::count (FANOUT_WEBSOCKET, 0, chunk->size);
+    }
+    return true;
+}
+
+//forget oldest data pending for client
+static void drop_ws_chunk (uint8_t num)
+{
+    ws_client_buffer & wb = wsBuffers[num];
+    if (wb.tx_count == 0) {
+        return;
+    }
+    uart_chunk * chunk = wb.tx[wb.tx_head];
+    UartFanout::count (FANOUT_WEBSOCKET, 0, chunk->size);
+    wb.dropped += chunk->size;
+    UartFanout::release (chunk);
+    wb.tx_head = (wb.tx_head + 1) % WS_CLIENT_TX_CHUNKS;
+    wb.tx_count--;
+}
+
+//new or gone client starts with nothing pending
+void ESPCOM::resetWSClient (uint8_t num)
+{
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+        return;
+    }
+    while (wsBuffers[num].tx_count > 0) {
+        drop_ws_chunk (num);
+    }
+    wsBuffers[num].tx_head = 0;
+    wsBuffers[num].dropped = 0;
+    wsBuffers[num].stalled_since = 0;
+}
+
+//send data pending for client, return false if client is disconnected
+//because it took nothing for too long
+static bool flush_ws_client (uint8_t num)
+{
+    ws_client_buffer & wb = wsBuffers[num];
+    while ((wb.tx_count > 0) && send_ws_chunk (num, wb.tx[wb.tx_head])) {
+        UartFanout::release (wb.tx[wb.tx_head]);
+        wb.tx_head = (wb.tx_head + 1) % WS_CLIENT_TX_CHUNKS;
+        wb.tx_count--;
+        wb.stalled_since = 0;
+    }
+    if (wb.tx_count == 0) {
+        wb.stalled_since = 0;
+        return true;
+    }
+    if (wb.stalled_since == 0) {
+        wb.stalled_since = millis();
+    } else if ((millis() - wb.stalled_since) > WS_CLIENT_STALL_TIMEOUT) {
+        log_esp3d ("Websocket client %d stalled", num);
+        socket_server->disconnect (num);
+        ESPCOM::resetWSClient (num);
+        return false;
+    }
+    return true;
+}
+
+//send chunk to all websocket clients, a client which cannot take it now
+//keeps a reference on it, when its queue is full its oldest data is lost
+//so a slow client never stalls the others
+void ESPCOM::send2WS (uart_chunk * chunk)
+{
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        if (!socket_server->isConnected (num) || !flush_ws_client (num)) {
+            continue;
+        }
+        ws_client_buffer & wb = wsBuffers[num];
+        if ((wb.tx_count == 0) && send_ws_chunk (num, chunk)) {
+            continue;
+        }
+        if (wb.tx_count == WS_CLIENT_TX_CHUNKS) {
+            drop_ws_chunk (num);
+        }
+        UartFanout::retain (chunk);
+        wb.tx[(wb.tx_head + wb.tx_count) % WS_CLIENT_TX_CHUNKS] = chunk;
+        wb.tx_count++;
+    }
+}
+
+//queue line for printer, lines are added whole so lines of different
+//clients are never mixed, return false if there is no room
+bool ESPCOM::pushWSLine (const char * line, size_t len)
+{
+    if ((len + 1) > (size_t) (WS_INPUT_SIZE - ws_input_size)) {
+        return false;
+    }
+    memcpy (&ws_input[ws_input_size], line, len);
+    ws_input_size += len;
+    ws_input[ws_input_size++] = '\n';
+    return true;
+}
+
+//send queued websocket lines as printer can take them, a data port
+//client sending a line keeps printer until its end and vice versa
+static void forward_ws()
+{
+    if ((ws_input_size == 0) || web_interface->blockserial || CONFIG::is_locked(FLAG_BLOCK_SERIAL)) {
+        return;
+    }
+#ifdef TCP_IP_DATA_FEATURE
+    if ((tcp_owner != -1) || tcp_midline) {
+        return;
+    }
+#endif
+    //a query owns printer between two lines
+    if (!ws_midline && serial_query.active()) {
+        return;
+    }
+    size_t len = ESPCOM::availableForWrite (DEFAULT_PRINTER_PIPE);
+    if (len > ws_input_size) {
+        len = ws_input_size;
+    }
+    if (len == 0) {
+        return;
+    }
+    len = ESPCOM::write (DEFAULT_PRINTER_PIPE, ws_input, len);
+    if (len == 0) {
+        return;
+    }
+    ws_midline = (ws_input[len - 1] != '\n');
+    ws_input_size -= len;
+    memmove (ws_input, &ws_input[len], ws_input_size);
+}
+
+//send what clients could not take yet
+void ESPCOM::flushWS()
+{
+    if (!socket_server) {
+        return;
+    }
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        if (wsBuffers[num].tx_count == 0) {
+            continue;
+        }
+        if (socket_server->isConnected (num)) {
+            flush_ws_client (num);
+        } else {
+            resetWSClient (num);
+        }
+    }
+}
+#endif
+
 #ifdef TCP_IP_DATA_FEATURE
 void ESPCOM::send2TCP (const __FlashStringHelper *data, bool async)
 {
@@ -377,71 +922,289 @@ void ESPCOM::send2TCP (String data, bool async)
 void ESPCOM::send2TCP (const char * data, bool async)
 {
     if (!async) {
-        for (uint8_t i = 0; i < MAX_SRV_CLIENTS; i++) {
-            if (serverClients[i] && serverClients[i].connected() ) {
-                serverClients[i].write (data, strlen (data) );
-                delay (0);
+        ESPCOM::send2TCP ((const uint8_t *)data, strlen (data));
+    }
+}
+
+//how many bytes client can take without waiting
+static size_t client_room (uint8_t i, size_t len)
+{
+#ifdef ARDUINO_ARCH_ESP8266
+    size_t room = serverClients[i].availableForWrite();
+    return (room < len) ? room : len;
+#else
+    return len;
+#endif
+}
+
+//send data pending in client tx queue
+static void flush_client (uint8_t i)
+{
+    tcp_client_buffer & cb = clientBuffers[i];
+    while (cb.tx_count > 0) {
+        uart_chunk * chunk = cb.tx[cb.tx_head];
+        size_t len = chunk->size - cb.tx_offset;
+        len = serverClients[i].write (&chunk->data[cb.tx_offset], client_room (i, len));
+        UartFanout::count (FANOUT_TCP + i, len);
+        cb.tx_offset += len;
+        if (cb.tx_offset < chunk->size) {
+            return;
+        }
+        UartFanout::release (chunk);
+        cb.tx_head = (cb.tx_head + 1) % TCP_CLIENT_TX_CHUNKS;
+        cb.tx_count--;
+        cb.tx_offset = 0;
+    }
+}
+
+//forget oldest data pending for client
+static void drop_client_chunk (uint8_t i)
+{
+    tcp_client_buffer & cb = clientBuffers[i];
+    if (cb.tx_count == 0) {
+        return;
+    }
+    uart_chunk * chunk = cb.tx[cb.tx_head];
+    UartFanout::count (FANOUT_TCP + i, 0, chunk->size - cb.tx_offset);
+    UartFanout::release (chunk);
+    cb.tx_head = (cb.tx_head + 1) % TCP_CLIENT_TX_CHUNKS;
+    cb.tx_count--;
+    cb.tx_offset = 0;
+}
+
+static void reset_client (uint8_t i)
+{
+    while (clientBuffers[i].tx_count > 0) {
+        drop_client_chunk (i);
+    }
+    clientBuffers[i].rx_size = 0;
+    clientBuffers[i].tx_head = 0;
+    if (tcp_owner == i) {
+        release_tcp_owner();
+    }
+}
+
+//write chunk to all clients, a client which cannot take it now
+//keeps a reference on it, or loses it if its queue is full,
+//so a slow client never stalls the others
+void ESPCOM::send2TCP (uart_chunk * chunk)
+{
+    for (uint8_t i = 0; i < MAX_SRV_CLIENTS; i++) {
+        if (!serverClients[i] || !serverClients[i].connected() ) {
+            continue;
+        }
+        tcp_client_buffer & cb = clientBuffers[i];
+        flush_client (i);
+        size_t sent = 0;
+        if (cb.tx_count == 0) {
+            sent = serverClients[i].write (chunk->data, client_room (i, chunk->size));
+            UartFanout::count (FANOUT_TCP + i, sent);
+            cb.tx_offset = sent;
+        }
+        if (sent < chunk->size) {
+            if (cb.tx_count < TCP_CLIENT_TX_CHUNKS) {
+                UartFanout::retain (chunk);
+                cb.tx[(cb.tx_head + cb.tx_count) % TCP_CLIENT_TX_CHUNKS] = chunk;
+                cb.tx_count++;
+            } else {
+                UartFanout::count (FANOUT_TCP + i, 0, chunk->size - sent);
             }
         }
     }
 }
+
+bool ESPCOM::hasTCPClient()
+{
+    for (uint8_t i = 0; i < MAX_SRV_CLIENTS; i++) {
+        if (serverClients[i] && serverClients[i].connected() ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ESPCOM::send2TCP (const uint8_t * data, size_t len)
+{
+    while (len > 0) {
+        uart_chunk * chunk = get_chunk();
+        if (!chunk) {
+            return;
+        }
+        chunk->size = (len > UART_POOL_CHUNK_SIZE) ? UART_POOL_CHUNK_SIZE : len;
+        memcpy (chunk->data, data, chunk->size);
+        ESPCOM::send2TCP (chunk);
+        UartFanout::release (chunk);
+        data += chunk->size;
+        len -= chunk->size;
+    }
+}
 #endif
 
 bool ESPCOM::processFromSerial (bool async)
 {
-    uint8_t i;
-    (void)i; //avoid warning if updater only
+    check_serial_errors();
     //check UART for data
-    if (ESPCOM::available(DEFAULT_PRINTER_PIPE)) {
-        size_t len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
-        uint8_t * sbuf = (uint8_t *)malloc(len+1);
-        if(!sbuf) {
-            return false;
-        }
-        sbuf[len] = '\0';
-        ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, sbuf, len);
+    size_t len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
+    if (len == 0) {
+        return false;
+    }
+    Metrics::setMax (METRIC_UART_RX_HIGH, len);
+    if (!serial_burst_ready (len)) {
+        return false;
+    }
+    //UART data is read once, all consumers share same chunk
+    uart_chunk * chunk = get_chunk();
+    if (!chunk) {
+        return false;
+    }
+    if (len > UART_POOL_CHUNK_SIZE) {
+        len = UART_POOL_CHUNK_SIZE;
+    }
+    long nb = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, chunk->data, len);
+    chunk->size = (nb > 0) ? nb : 0;
+    Metrics::add (METRIC_UART_RX_BYTES, chunk->size);
 #ifdef TCP_IP_DATA_FEATURE
-        if (!async &&  !CONFIG::is_locked(FLAG_BLOCK_TCP)) {
-            if ((WiFi.getMode() != WIFI_OFF)  || !wifi_config.WiFi_on) {
-                //push UART data to all connected tcp clients
-                for (i = 0; i < MAX_SRV_CLIENTS; i++) {
-                    if (serverClients[i] && serverClients[i].connected() ) {
-                        serverClients[i].write (sbuf, len);
-                        delay (0);
-                    }
-                }
-            }
+    if (!async &&  !CONFIG::is_locked(FLAG_BLOCK_TCP)) {
+        if ((WiFi.getMode() != WIFI_OFF)  || !wifi_config.WiFi_on) {
+            //push UART data to all connected tcp clients
+            ESPCOM::send2TCP (chunk);
         }
+    }
 #endif
 #ifdef WS_DATA_FEATURE
 
 #if defined (ASYNCWEBSERVER)
-        if (!CONFIG::is_locked(FLAG_BLOCK_WSOCKET)) {
-            web_interface->web_socket.textAll(sbuf, len);
-        }
+    if (!CONFIG::is_locked(FLAG_BLOCK_WSOCKET)) {
+        web_interface->web_socket.textAll(chunk->data, chunk->size);
+    }
 #else
-        if (!CONFIG::is_locked(FLAG_BLOCK_WSOCKET) && socket_server) {
+    if (!CONFIG::is_locked(FLAG_BLOCK_WSOCKET) && socket_server) {
 #ifndef DEBUG_OUTPUT_SOCKET
-            if(socket_server){
-                socket_server->sendBIN(current_socket_id,sbuf,len);
-                }
+        //push UART data to all connected websocket clients
+        ESPCOM::send2WS (chunk);
 #endif
-        }
+    }
 #endif
 
 #endif
-        //process data if any
-        COMMAND::read_buffer_serial (sbuf, len);
-        free(sbuf);
-        return true;
-    } else {
+    //process data if any
+    COMMAND::read_buffer_serial (chunk->data, chunk->size);
+    UartFanout::count (FANOUT_PARSER, chunk->size);
+    //answer of a queued command
+    serial_query.feed (chunk->data, chunk->size);
+    UartFanout::release (chunk);
+    return true;
+}
+//no client is in middle of a line, ESP can send its own commands
+bool ESPCOM::printerLineFree()
+{
+#ifdef TCP_IP_DATA_FEATURE
+    if ((tcp_owner != -1) || tcp_midline) {
+        return false;
+    }
+#endif
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+    if (ws_midline) {
         return false;
     }
+#endif
+    return true;
 }
 #ifdef TCP_IP_DATA_FEATURE
+//next client gets printer, if line of owner is not ended
+//it will be before anything else is sent
+static void release_tcp_owner()
+{
+    tcp_last_owner = tcp_owner;
+    tcp_owner = -1;
+}
+
+//push client data to printer, one client at a time:
+//a client starting a line keeps printer until end of line,
+//then next client with data gets its turn
+static void forward_clients()
+{
+    size_t room = ESPCOM::availableForWrite (DEFAULT_PRINTER_PIPE);
+    while (room > 0) {
+        if (tcp_owner == -1) {
+            //printer must not join a cut line with next data
+            if (tcp_midline) {
+#ifdef MEATPACK_FEATURE
+                MeatPack::suspend();
+#endif
+                if (ESPCOM::write (DEFAULT_PRINTER_PIPE, '\n') == 0) {
+                    return;
+                }
+                tcp_midline = false;
+                room--;
+                continue;
+            }
+            //a query owns printer between two lines
+            if (serial_query.active()) {
+                return;
+            }
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+            //websocket lines go first between two lines
+            if (ws_midline || (ws_input_size > 0)) {
+                return;
+            }
+#endif
+            for (uint8_t n = 1; n <= MAX_SRV_CLIENTS; n++) {
+                uint8_t c = (tcp_last_owner + n) % MAX_SRV_CLIENTS;
+                if (clientBuffers[c].rx_size > 0) {
+                    tcp_owner = c;
+                    tcp_owner_activity = millis();
+                    break;
+                }
+            }
+            if (tcp_owner == -1) {
+                return;
+            }
+        }
+        tcp_client_buffer & cb = clientBuffers[tcp_owner];
+        //do not keep printer for a client which does not finish its line
+        if (cb.rx_size == 0) {
+            if ((millis() - tcp_owner_activity) > TCP_LINE_TIMEOUT) {
+                release_tcp_owner();
+                continue;
+            }
+            return;
+        }
+        //send up to end of line only
+        size_t len = 0;
+        bool eol = false;
+        while (!eol && (len < cb.rx_size)) {
+            eol = (cb.rx[len] == '\n') || (cb.rx[len] == '\r');
+            len++;
+        }
+        //printer buffer is full, wait for room
+        if (len > room) {
+            len = room;
+            eol = false;
+        }
+#ifdef MEATPACK_FEATURE
+        //client bytes are never packed, host may pack them itself
+        MeatPack::suspend();
+#endif
+        len = ESPCOM::write (DEFAULT_PRINTER_PIPE, cb.rx, len);
+        if (len == 0) {
+            return;
+        }
+        COMMAND::read_buffer_tcp (cb.rx, len);
+        cb.rx_size -= len;
+        memmove (cb.rx, &cb.rx[len], cb.rx_size);
+        room -= len;
+        tcp_owner_activity = millis();
+        tcp_midline = !eol;
+        if (eol) {
+            release_tcp_owner();
+        }
+    }
+}
+
 void ESPCOM::processFromTCP2Serial()
 {
-    uint8_t i, data;
+    uint8_t i;
     //check if there are any new clients
     if (data_server->hasClient() ) {
         for (i = 0; i < MAX_SRV_CLIENTS; i++) {
@@ -451,28 +1214,54 @@ void ESPCOM::processFromTCP2Serial()
                     serverClients[i].stop();
                 }
                 serverClients[i] = data_server->available();
-                continue;
+                reset_client (i);
+                break;
             }
         }
         //no free/disconnected spot so reject
-        WiFiClient serverClient = data_server->available();
-        serverClient.stop();
+        if (i == MAX_SRV_CLIENTS) {
+            WiFiClient serverClient = data_server->available();
+            serverClient.stop();
+        }
+    }
+    //send what clients could not take yet
+    for (i = 0; i < MAX_SRV_CLIENTS; i++) {
+        if (serverClients[i] && serverClients[i].connected() ) {
+            flush_client (i);
+        } else {
+            //give back chunks kept for a gone client
+            while (clientBuffers[i].tx_count > 0) {
+                drop_client_chunk (i);
+            }
+            //and forget what it did not send yet
+            clientBuffers[i].rx_size = 0;
+            if (tcp_owner == i) {
+                release_tcp_owner();
+            }
+        }
     }
     //check clients for data
     //to avoid any pollution if Uploading file to SDCard
-    if (!((web_interface->blockserial)  || CONFIG::is_locked(FLAG_BLOCK_TCP) || CONFIG::is_locked(FLAG_BLOCK_SERIAL))) {
-        for (i = 0; i < MAX_SRV_CLIENTS; i++) {
-            if (serverClients[i] && serverClients[i].connected() ) {
-                if (serverClients[i].available() ) {
-                    //get data from the tcp client and push it to the UART
-                    while (serverClients[i].available() ) {
-                        data = serverClients[i].read();
-                        ESPCOM::write(DEFAULT_PRINTER_PIPE, data);
-                        COMMAND::read_buffer_tcp (data);
-                    }
+    if ((web_interface->blockserial)  || CONFIG::is_locked(FLAG_BLOCK_TCP) || CONFIG::is_locked(FLAG_BLOCK_SERIAL)) {
+        return;
+    }
+    for (i = 0; i < MAX_SRV_CLIENTS; i++) {
+        if (serverClients[i] && serverClients[i].connected() ) {
+            tcp_client_buffer & cb = clientBuffers[i];
+            //when buffer is full, data stay in socket and client is slowed down by tcp
+            size_t len = serverClients[i].available();
+            if (len > (size_t)(TCP_CLIENT_RX_SIZE - cb.rx_size)) {
+                len = TCP_CLIENT_RX_SIZE - cb.rx_size;
+            }
+            if (len > 0) {
+                int nb = serverClients[i].read (&cb.rx[cb.rx_size], len);
+                if (nb > 0) {
+                    cb.rx_size += nb;
+                    Metrics::setMax (METRIC_TCP_RX_HIGH, cb.rx_size);
                 }
             }
         }
     }
+    forward_clients();
 }
 #endif
@@ -22,6 +22,7 @@
 #define ESPCOM_H
 #include <WiFiServer.h>
 #include "config.h"
+#include "uart_fanout.h"
 #ifdef TCP_IP_DATA_FEATURE
 extern WiFiServer * data_server;
 #endif
@@ -30,12 +31,17 @@ class ESPCOM
 {
 public:
     static size_t  write(tpipe output, uint8_t d);
+    static size_t  write(tpipe output, const uint8_t * data, size_t len);
+    static size_t availableForWrite(tpipe output);
     static long readBytes (tpipe output, uint8_t * sbuf, size_t len);
     static long baudRate(tpipe output);
     static size_t available(tpipe output);
     static void flush(tpipe output, ESPResponseStream  *espresponse = NULL);
     static void bridge(bool async = false);
+    static void configureSerialRx (long baud_rate);
+    static void beginSerialTask();
     static bool processFromSerial (bool async = false);
+    static bool printerLineFree();
     static void print (const __FlashStringHelper *data, tpipe output, ESPResponseStream  *espresponse = NULL);
     static void print (String & data, tpipe output, ESPResponseStream  *espresponse = NULL);
     static void print (const char * data, tpipe output, ESPResponseStream  *espresponse = NULL);
@@ -48,6 +54,15 @@ public:
     static void send2TCP (const __FlashStringHelper *data, bool async = false);
     static void send2TCP (String data, bool async = false);
     static void send2TCP (const char * data, bool async = false);
+    static void send2TCP (const uint8_t * data, size_t len);
+    static void send2TCP (uart_chunk * chunk);
+    static bool hasTCPClient();
+#endif
+#if defined(WS_DATA_FEATURE) && !defined(ASYNCWEBSERVER)
+    static void send2WS (uart_chunk * chunk);
+    static void flushWS();
+    static void resetWSClient (uint8_t num);
+    static bool pushWSLine (const char * line, size_t len);
 #endif
     static bool block_2_printer;
 #ifdef ESP_OLED_FEATURE
@@ -0,0 +1,205 @@
+/*
+  gcode_minifier.cpp - ESP3D gcode compaction class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#if !defined(USE_AS_UPDATER_ONLY) && defined(GCODE_MINIFIER_FEATURE)
+#include "gcode_minifier.h"
+#include "metrics.h"
+
+//number is [+-]digits[.digits] with at least one digit
+//+ sign, leading zeros and trailing zeros are removed
+//return 0 if not a number or too long
+static size_t compact_number(const char * p, size_t len, char * out, size_t size)
+{
+    size_t i = 0;
+    size_t n = 0;
+    size_t digits = 0;
+    bool dot = false;
+    if (len >= size) {
+        return 0;
+    }
+    for (size_t j = 0; j < len; j++) {
+        if (isdigit((uint8_t)p[j])) {
+            digits++;
+        } else if ((p[j] == '.') && !dot) {
+            dot = true;
+        } else if (((p[j] != '-') && (p[j] != '+')) || (j > 0)) {
+            return 0;
+        }
+    }
+    if (digits == 0) {
+        return 0;
+    }
+    if ((p[0] == '-') || (p[0] == '+')) {
+        if (p[0] == '-') {
+            out[n++] = '-';
+        }
+        i++;
+    }
+    //one zero is kept before dot
+    while (((i + 1) < len) && (p[i] == '0') && isdigit(p[i + 1])) {
+        i++;
+    }
+    while ((i < len) && isdigit(p[i])) {
+        out[n++] = p[i++];
+    }
+    if (i < len) {
+        //dot and what is left of fractional part
+        size_t end = len;
+        while ((end > (i + 1)) && (p[end - 1] == '0')) {
+            end--;
+        }
+        if (end > (i + 1)) {
+            memcpy(out + n, p + i, end - i);
+            n += end - i;
+        }
+    }
+    //.0 or -.0
+    if ((n == 0) || (out[n - 1] == '-')) {
+        out[n++] = '0';
+    }
+    return n;
+}
+
+GcodeMinifier::GcodeMinifier()
+{
+    begin(UNKNOWN_FW);
+}
+
+void GcodeMinifier::begin(uint8_t firmware)
+{
+    //these parsers find words without spaces
+    _keep_spaces = !((firmware == MARLIN) || (firmware == MARLINKIMBRA) || (firmware == GRBL));
+    //only Grbl takes a line of axis words as a move in current motion mode
+    _modal = (firmware == GRBL);
+    _bytes_in = 0;
+    _bytes_out = 0;
+    forget();
+}
+
+void GcodeMinifier::forget()
+{
+    _motion = -1;
+    _feedrate[0] = '\0';
+}
+
+//return 0 if line is not a simple G line
+size_t GcodeMinifier::compact(const char * line, size_t len, char * out)
+{
+    char number[GCODE_MINIFIER_NUMBER_SIZE];
+    int32_t command = -1;
+    bool omitted = false;
+    bool spaced = false;
+    size_t size = 0;
+    size_t i = 0;
+    //other commands may have text parameters
+    if ((len == 0) || (line[0] != 'G')) {
+        return 0;
+    }
+    while (i < len) {
+        char letter = line[i++];
+        if ((letter == ' ') || (letter == '\t')) {
+            spaced = true;
+            continue;
+        }
+        if ((letter < 'A') || (letter > 'Z')) {
+            return 0;
+        }
+        size_t start = i;
+        while ((i < len) && (isdigit((uint8_t)line[i]) || (line[i] == '.') || (line[i] == '-') || (line[i] == '+'))) {
+            i++;
+        }
+        size_t n = compact_number(line + start, i - start, number, sizeof(number));
+        if (n == 0) {
+            return 0;
+        }
+        number[n] = '\0';
+        if (start == 1) {
+            //G38.2 and alike are kept as they are and are not tracked
+            if (memchr(line + start, '.', i - start)) {
+                n = i - start;
+                memcpy(number, line + start, n);
+            } else {
+                command = atoi(number);
+            }
+            if (_modal && ((command == 0) || (command == 1)) && (command == _motion)) {
+                omitted = true;
+                continue;
+            }
+        } else if ((letter == 'G') || (letter == 'M') || (letter == 'T') || (letter == 'N')) {
+            //several commands or numbered line
+            return 0;
+        } else if ((letter == 'F') && (command == 1)) {
+            //feedrate is modal
+            if (strcmp(number, _feedrate) == 0) {
+                continue;
+            }
+            strcpy(_feedrate, number);
+        }
+        if ((size > 0) && spaced && _keep_spaces) {
+            out[size++] = ' ';
+        }
+        spaced = false;
+        out[size++] = letter;
+        memcpy(out + size, number, n);
+        size += n;
+    }
+    //nothing else than motion command, keep it
+    if (omitted && (size == 0)) {
+        out[size++] = 'G';
+        out[size++] = '0' + command;
+    }
+    _motion = ((command >= 0) && (command <= 3)) ? command : -1;
+    //anything else than G1 may change feedrate
+    if (command != 1) {
+        _feedrate[0] = '\0';
+    }
+    return size;
+}
+
+size_t GcodeMinifier::minify(const char * line, size_t len, char * out)
+{
+    size_t size;
+    _bytes_in += len;
+    Metrics::add (METRIC_MINIFIER_IN_BYTES, len);
+    //comment is not sent
+    const char * comment = (const char *)memchr(line, ';', len);
+    if (comment) {
+        len = comment - line;
+    }
+    while ((len > 0) && isspace((uint8_t)line[0])) {
+        line++;
+        len--;
+    }
+    while ((len > 0) && isspace((uint8_t)line[len - 1])) {
+        len--;
+    }
+    size = compact(line, len, out);
+    if (size == 0) {
+        forget();
+        memcpy(out, line, len);
+        size = len;
+    }
+    out[size] = '\0';
+    _bytes_out += size;
+    Metrics::add (METRIC_MINIFIER_OUT_BYTES, size);
+    return size;
+}
+#endif //USE_AS_UPDATER_ONLY && GCODE_MINIFIER_FEATURE
@@ -0,0 +1,65 @@
+/*
+  gcode_minifier.h - ESP3D gcode compaction class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _GCODE_MINIFIER_H
+#define _GCODE_MINIFIER_H
+#include <Arduino.h>
+#include "config.h"
+
+//longest line handled by callers, longer lines are sent as they are
+#define GCODE_MINIFIER_LINE_SIZE 256
+//longest number kept for feedrate comparison
+#define GCODE_MINIFIER_NUMBER_SIZE 16
+
+//Make gcode lines shorter without changing what printer does:
+//comments and useless zeros are removed from all G lines,
+//spaces between words only if firmware does not need them,
+//F of a G1 is removed if it is same as previous G1 one,
+//and on Grbl G0/G1 is removed if it is already the motion mode.
+//Any other line is only trimmed and modal state is forgotten.
+class GcodeMinifier
+{
+public:
+    GcodeMinifier();
+    //forget modal state, to call before a new stream
+    void begin(uint8_t firmware);
+    //out must hold len + 1 chars, result is never longer than line
+    //return 0 if nothing has to be sent
+    size_t minify(const char * line, size_t len, char * out);
+    uint32_t bytesIn()
+    {
+        return _bytes_in;
+    };
+    uint32_t bytesOut()
+    {
+        return _bytes_out;
+    };
+private:
+    bool _keep_spaces;
+    bool _modal;
+    int8_t _motion;
+    char _feedrate[GCODE_MINIFIER_NUMBER_SIZE];
+    uint32_t _bytes_in;
+    uint32_t _bytes_out;
+    void forget();
+    size_t compact(const char * line, size_t len, char * out);
+};
+
+#endif //_GCODE_MINIFIER_H
@@ -0,0 +1,308 @@
+/*
+  gcode_streamer.cpp - ESP3D windowed gcode streaming class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#include "espcom.h"
+#include "response_classifier.h"
+#include "metrics.h"
+#include "printer_state.h"
+#include "line_framer.h"
+
+#define NB_RETRY 5
+
+GcodeStreamer gcode_streamer;
+
+GcodeStreamer::GcodeStreamer()
+{
+    _started = false;
+    _failed = false;
+    _window = SERIAL_STREAM_WINDOW;
+    _rx_size = PRINTER_RX_BUFFER_SIZE;
+    _first_line = 0;
+    _last_sent = 0;
+    _next_line = 1;
+    _last_resend = -1;
+    _resend_ignore = 0;
+    _resend_retry = 0;
+    _lines_sent = 0;
+    _resend_total = 0;
+    _last_activity = 0;
+    _inflight_head = 0;
+    _inflight_count = 0;
+    _inflight_bytes = 0;
+    _response_size = 0;
+}
+
+//first_line is the number of the first line to be pushed
+//numbering must already be set on printer side (M110)
+bool GcodeStreamer::begin(int32_t first_line, uint8_t window, uint16_t rx_size)
+{
+    if (first_line < 0) {
+        return false;
+    }
+    //keep some lines in ring after the window for resend
+    if (window > SERIAL_STREAM_RING_SIZE / 2) {
+        window = SERIAL_STREAM_RING_SIZE / 2;
+    }
+    if (window == 0) {
+        window = 1;
+    }
+    _window = window;
+    _rx_size = rx_size;
+    _first_line = first_line;
+    _last_sent = first_line - 1;
+    _next_line = first_line;
+    _last_resend = -1;
+    _resend_ignore = 0;
+    _resend_retry = 0;
+    _lines_sent = 0;
+    _resend_total = 0;
+    _inflight_head = 0;
+    _inflight_count = 0;
+    _inflight_bytes = 0;
+    _response_size = 0;
+    for (uint8_t i = 0; i < SERIAL_STREAM_RING_SIZE; i++) {
+        _ring[i].number = -1;
+        _ring[i].size = 0;
+    }
+    _failed = false;
+    _started = true;
+    _last_activity = millis();
+    log_esp3d("Streamer start at line %d, window %d, rx %d", first_line, _window, _rx_size);
+    return true;
+}
+
+void GcodeStreamer::end()
+{
+    log_esp3d("Streamer end: %d lines, %d resend", _lines_sent, _resend_total);
+    _started = false;
+    _inflight_count = 0;
+    _inflight_bytes = 0;
+}
+
+void GcodeStreamer::setFailed(const char * reason)
+{
+    (void)reason;
+    log_esp3d("Streamer error: %s", reason);
+    _failed = true;
+}
+
+//can a line of this size be sent now without overflowing printer buffer
+bool GcodeStreamer::canSend(uint16_t size)
+{
+    if (_inflight_count == 0) {
+        return true;
+    }
+    if (_inflight_count >= _window) {
+        return false;
+    }
+    return (_inflight_bytes + size) <= _rx_size;
+}
+
+//send again a line already in ring, return false if no room yet
+bool GcodeStreamer::sendRingLine(int32_t number)
+{
+    sent_line * slot = &_ring[number % SERIAL_STREAM_RING_SIZE];
+    if (slot->number != number) {
+        setFailed("Line not in ring");
+        return false;
+    }
+    if (!canSend(slot->size)) {
+        return false;
+    }
+    ESPCOM::print (slot->data, DEFAULT_PRINTER_PIPE);
+    uint8_t index = (_inflight_head + _inflight_count) % SERIAL_STREAM_RING_SIZE;
+    _inflight[index].number = number;
+    _inflight[index].size = slot->size;
+    _inflight_count++;
+    _inflight_bytes += slot->size;
+    _last_activity = millis();
+    return true;
+}
+
+//send lines requested by a resend
+void GcodeStreamer::sendPending()
+{
+    while (!_failed && (_next_line <= _last_sent)) {
+        if (!sendRingLine(_next_line)) {
+            return;
+        }
+        _next_line++;
+    }
+}
+
+//number is -1 if ack has no line number
+void GcodeStreamer::ackLine(int32_t number)
+{
+    if (_inflight_count == 0) {
+        return;
+    }
+    uint8_t nb = 1;
+    if (number >= 0) {
+        //look for the most recent sending of this line
+        for (uint8_t i = _inflight_count; i > 0; i--) {
+            if (_inflight[(_inflight_head + i - 1) % SERIAL_STREAM_RING_SIZE].number == number) {
+                nb = i;
+                break;
+            }
+        }
+    }
+    while (nb > 0) {
+        _inflight_bytes -= _inflight[_inflight_head].size;
+        _inflight_head = (_inflight_head + 1) % SERIAL_STREAM_RING_SIZE;
+        _inflight_count--;
+        nb--;
+    }
+}
+
+void GcodeStreamer::handleResponse(const char * line, size_t len)
+{
+    response_info response;
+    ResponseClassifier::classify(line, len, response);
+    PrinterState::update(line, len, response);
+    //Marlin advanced ok is "ok N<line>", repetier is "ok <line>"
+    if (response.type == RESPONSE_ACK) {
+        _last_activity = millis();
+        ackLine(response.number);
+        return;
+    }
+    //repetier skip of a line is followed by an ok, window moves then
+    if (response.type == RESPONSE_SKIP) {
+        _last_activity = millis();
+        return;
+    }
+    //status lines like temperature auto report do not mean window moves
+    if (response.type != RESPONSE_RESEND) {
+        return;
+    }
+    _last_activity = millis();
+    int32_t number = response.number;
+    //following lines already in printer buffer may ask same line again
+    if ((_resend_ignore > 0) && (number == _last_resend)) {
+        _resend_ignore--;
+        return;
+    }
+    if (number == _last_resend) {
+        _resend_retry++;
+        if (_resend_retry > NB_RETRY) {
+            setFailed("Too many resend");
+            return;
+        }
+    } else {
+        _last_resend = number;
+        _resend_retry = 0;
+    }
+    if ((number < _first_line) || (number > _last_sent) || (_ring[number % SERIAL_STREAM_RING_SIZE].number != number)) {
+        setFailed("Wrong line requested");
+        return;
+    }
+    log_esp3d("Resend %d requested", number);
+    _resend_ignore = _last_sent - number;
+    _resend_total++;
+    Metrics::add (METRIC_RESENDS);
+    _next_line = number;
+}
+
+//read printer answers and send again requested lines
+bool GcodeStreamer::process()
+{
+    if (!_started || _failed) {
+        return false;
+    }
+    uint8_t buf[64];
+    size_t len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
+    while (len > 0) {
+        if (len > sizeof(buf)) {
+            len = sizeof(buf);
+        }
+        len = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, buf, len);
+        for (size_t i = 0; i < len; i++) {
+            if ((buf[i] == '\n') || (buf[i] == '\r')) {
+                if (_response_size > 0) {
+                    _response[_response_size] = '\0';
+                    handleResponse(_response, _response_size);
+                    _response_size = 0;
+                }
+            } else if (_response_size < (SERIAL_STREAM_RESPONSE_SIZE - 1)) {
+                _response[_response_size++] = buf[i];
+            }
+        }
+        len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
+    }
+    sendPending();
+    if ((_inflight_count > 0) && ((millis() - _last_activity) > SERIAL_STREAM_TIMEOUT)) {
+        setFailed("Time out");
+    }
+    return !_failed;
+}
+
+//queue line, waiting for room in printer buffer if necessary
+bool GcodeStreamer::push(const char * line)
+{
+    if (!_started || _failed) {
+        return false;
+    }
+    int32_t number = _last_sent + 1;
+    sent_line * slot = &_ring[number % SERIAL_STREAM_RING_SIZE];
+    while (process()) {
+        //resend requested lines first
+        //and do not overwrite a line which may still be requested
+        if ((_next_line > _last_sent) &&
+                ((_inflight_count == 0) || (_inflight[_inflight_head].number > (number - SERIAL_STREAM_RING_SIZE)))) {
+#ifdef DISABLE_SERIAL_CHECKSUM
+            size_t size = LineFramer::frame(slot->data, SERIAL_STREAM_LINE_SIZE, line, strlen(line), -1);
+#else
+            size_t size = LineFramer::frame(slot->data, SERIAL_STREAM_LINE_SIZE, line, strlen(line), number);
+#endif
+            if (size == 0) {
+                slot->number = -1;
+                setFailed("Line too long");
+                return false;
+            }
+            slot->number = number;
+            slot->size = size;
+            if (canSend(size)) {
+                _last_sent = number;
+                _next_line = number + 1;
+                _lines_sent++;
+                //cannot fail as room has been checked
+                sendRingLine(number);
+                return true;
+            }
+        }
+        CONFIG::wait(0);
+    }
+    return false;
+}
+
+//wait until all sent lines are acknowledged
+bool GcodeStreamer::drain()
+{
+    while (process()) {
+        if ((_inflight_count == 0) && (_next_line > _last_sent)) {
+            return true;
+        }
+        CONFIG::wait(0);
+    }
+    return false;
+}
+#endif //USE_AS_UPDATER_ONLY
@@ -0,0 +1,106 @@
+/*
+  gcode_streamer.h - ESP3D windowed gcode streaming class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _GCODE_STREAMER_H
+#define _GCODE_STREAMER_H
+#include <Arduino.h>
+#include "config.h"
+
+//lines kept for resend, must be at least twice the window
+#define SERIAL_STREAM_RING_SIZE 8
+//N<line> <gcode>*<checksum>\n
+#define SERIAL_STREAM_LINE_SIZE 256
+#define SERIAL_STREAM_RESPONSE_SIZE 128
+//no answer from printer during this time means failure
+#define SERIAL_STREAM_TIMEOUT 2000
+
+//Send numbered lines to printer without waiting the ok of each line:
+//up to window lines (and rx_size bytes) can be in flight at once,
+//sent lines are kept in a ring so they can be sent again on resend request
+class GcodeStreamer
+{
+public:
+    GcodeStreamer();
+    bool begin(int32_t first_line, uint8_t window = SERIAL_STREAM_WINDOW, uint16_t rx_size = PRINTER_RX_BUFFER_SIZE);
+    void end();
+    bool push(const char * line);
+    bool drain();
+    bool process();
+    bool started()
+    {
+        return _started;
+    };
+    bool failed()
+    {
+        return _failed;
+    };
+    int32_t nextLineNumber()
+    {
+        return _last_sent + 1;
+    };
+    uint32_t linesSent()
+    {
+        return _lines_sent;
+    };
+    uint32_t resendCount()
+    {
+        return _resend_total;
+    };
+private:
+    struct sent_line {
+        int32_t number;
+        uint16_t size;
+        char data[SERIAL_STREAM_LINE_SIZE];
+    };
+    struct inflight_line {
+        int32_t number;
+        uint16_t size;
+    };
+    bool _started;
+    bool _failed;
+    uint8_t _window;
+    uint16_t _rx_size;
+    int32_t _first_line;
+    int32_t _last_sent;
+    int32_t _next_line;
+    int32_t _last_resend;
+    int32_t _resend_ignore;
+    uint8_t _resend_retry;
+    uint32_t _lines_sent;
+    uint32_t _resend_total;
+    uint32_t _last_activity;
+    sent_line _ring[SERIAL_STREAM_RING_SIZE];
+    inflight_line _inflight[SERIAL_STREAM_RING_SIZE];
+    uint8_t _inflight_head;
+    uint8_t _inflight_count;
+    uint16_t _inflight_bytes;
+    char _response[SERIAL_STREAM_RESPONSE_SIZE];
+    uint16_t _response_size;
+    bool canSend(uint16_t size);
+    bool sendRingLine(int32_t number);
+    void sendPending();
+    void ackLine(int32_t number);
+    void handleResponse(const char * line, size_t len);
+    void setFailed(const char * reason);
+};
+
+extern GcodeStreamer gcode_streamer;
+
+#endif //_GCODE_STREAMER_H
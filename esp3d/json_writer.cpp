@@ -0,0 +1,119 @@
+/*
+  json_writer.cpp - ESP3D buffered json output class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "json_writer.h"
+#include "espcom.h"
+
+JsonWriter::JsonWriter(tpipe output, ESPResponseStream  *espresponse)
+{
+    _output = output;
+    _espresponse = espresponse;
+    _size = 0;
+}
+
+JsonWriter::~JsonWriter()
+{
+    flush();
+}
+
+void JsonWriter::write(const char * data, size_t len, bool progmem)
+{
+    while (len > 0) {
+        size_t room = JSON_WRITER_CHUNK_SIZE - _size;
+        if (room == 0) {
+            flush();
+            room = JSON_WRITER_CHUNK_SIZE;
+        }
+        if (room > len) {
+            room = len;
+        }
+        if (progmem) {
+            memcpy_P(_buffer + _size, data, room);
+        } else {
+            memcpy(_buffer + _size, data, room);
+        }
+        _size += room;
+        data += room;
+        len -= room;
+    }
+}
+
+void JsonWriter::print(const char * data)
+{
+    write(data, strlen(data), false);
+}
+
+void JsonWriter::print(const __FlashStringHelper * data)
+{
+    PGM_P p = reinterpret_cast<PGM_P>(data);
+    write(p, strlen_P(p), true);
+}
+
+void JsonWriter::print(int value)
+{
+    char tmp[12];
+    write(tmp, sprintf(tmp, "%d", value), false);
+}
+
+void JsonWriter::printEncoded(const char * data)
+{
+    if (*data == '\0') {
+        write(" ", 1, false);
+        return;
+    }
+    const char * start = data;
+    for (; *data; data++) {
+        if ((*data == '\'') || (*data == '"')) {
+            write(start, data - start, false);
+            print((*data == '"') ? "&#34;" : "&#39;");
+            start = data + 1;
+        }
+    }
+    write(start, data - start, false);
+}
+
+void JsonWriter::println(const char * data)
+{
+    print(data);
+#ifdef TCP_IP_DATA_FEATURE
+    write("\r", 1, false);
+#endif
+    write("\n", 1, false);
+}
+
+void JsonWriter::println(const __FlashStringHelper * data)
+{
+    print(data);
+#ifdef TCP_IP_DATA_FEATURE
+    write("\r", 1, false);
+#endif
+    write("\n", 1, false);
+}
+
+void JsonWriter::flush()
+{
+    if (_size == 0) {
+        return;
+    }
+    _buffer[_size] = '\0';
+    ESPCOM::print (_buffer, _output, _espresponse);
+    _size = 0;
+}
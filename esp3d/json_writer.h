@@ -0,0 +1,53 @@
+/*
+  json_writer.h - ESP3D buffered json output class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _JSON_WRITER_H
+#define _JSON_WRITER_H
+#include <Arduino.h>
+#include "config.h"
+
+//size of chunks sent to output
+#define JSON_WRITER_CHUNK_SIZE 512
+
+//Collect small pieces of json in a fixed buffer
+//and send them to output only when buffer is full
+class JsonWriter
+{
+public:
+    JsonWriter(tpipe output, ESPResponseStream  *espresponse = NULL);
+    ~JsonWriter();
+    void print(const char * data);
+    void print(const __FlashStringHelper * data);
+    void print(int value);
+    //' and " are html encoded, empty string is sent as space
+    void printEncoded(const char * data);
+    //same end of line as ESPCOM::println
+    void println(const char * data);
+    void println(const __FlashStringHelper * data);
+    void flush();
+private:
+    tpipe _output;
+    ESPResponseStream * _espresponse;
+    char _buffer[JSON_WRITER_CHUNK_SIZE + 1];
+    size_t _size;
+    void write(const char * data, size_t len, bool progmem);
+};
+
+#endif //_JSON_WRITER_H
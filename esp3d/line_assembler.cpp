@@ -0,0 +1,84 @@
+/*
+  line_assembler.cpp - ESP3D incoming lines assembler class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "line_assembler.h"
+
+LineAssembler::LineAssembler()
+{
+    reset();
+}
+
+void LineAssembler::reset()
+{
+    _size = 0;
+    _line[0] = '\0';
+    _ready = false;
+    _comment = false;
+    _overflow = false;
+}
+
+//add a run of printable chars
+void LineAssembler::append(const uint8_t * data, size_t len)
+{
+    if (_comment || _overflow) {
+        return;
+    }
+    //is there a comment ?
+    const uint8_t * p = (const uint8_t *)memchr(data, ';', len);
+    if (p) {
+        len = p - data;
+        _comment = true;
+    }
+    if ((_size + len) > LINE_ASSEMBLER_SIZE) {
+        _overflow = true;
+        return;
+    }
+    memcpy(_line + _size, data, len);
+    _size += len;
+}
+
+size_t LineAssembler::feed(const uint8_t * data, size_t len)
+{
+    size_t i = 0;
+    //previous line has been handled
+    if (_ready) {
+        reset();
+    }
+    while (i < len) {
+        if (isPrintable(data[i])) {
+            //take the whole printable part at once
+            size_t start = i;
+            while ((i < len) && isPrintable(data[i])) {
+                i++;
+            }
+            append(data + start, i - start);
+            continue;
+        }
+        uint8_t c = data[i++];
+        if (((c == '\r') || (c == '\n')) && (_size > 0) && !_overflow) {
+            _line[_size] = '\0';
+            _ready = true;
+            return i;
+        }
+        //not a char so start again
+        reset();
+    }
+    return i;
+}
@@ -0,0 +1,60 @@
+/*
+  line_assembler.h - ESP3D incoming lines assembler class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _LINE_ASSEMBLER_H
+#define _LINE_ASSEMBLER_H
+#include <Arduino.h>
+
+//longest line kept, longer lines are dropped
+#define LINE_ASSEMBLER_SIZE 256
+
+//Build lines from incoming chunks without any allocation:
+//only printable chars are kept, comments (after ';') are removed,
+//any other non printable char than end of line resets current line
+class LineAssembler
+{
+public:
+    LineAssembler();
+    void reset();
+    //use data until a line is complete, return number of bytes used
+    size_t feed(const uint8_t * data, size_t len);
+    //line is complete, it stays valid until next feed
+    bool ready()
+    {
+        return _ready;
+    };
+    const char * line()
+    {
+        return _line;
+    };
+    size_t length()
+    {
+        return _size;
+    };
+private:
+    char _line[LINE_ASSEMBLER_SIZE + 1];
+    size_t _size;
+    bool _ready;
+    bool _comment;
+    bool _overflow;
+    void append(const uint8_t * data, size_t len);
+};
+
+#endif //_LINE_ASSEMBLER_H
@@ -0,0 +1,74 @@
+/*
+  line_framer.cpp - ESP3D gcode line numbering class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "line_framer.h"
+
+//decimal digits of value, return number of digits
+static size_t format_number (uint32_t value, char * out)
+{
+    char digits[10];
+    size_t n = 0;
+    do {
+        digits[n++] = '0' + (value % 10);
+        value /= 10;
+    } while (value > 0);
+    for (size_t i = 0; i < n; i++) {
+        out[i] = digits[n - 1 - i];
+    }
+    return n;
+}
+
+size_t LineFramer::frame (char * buffer, size_t size, const char * line, size_t len, int32_t linenb)
+{
+    size_t n = 0;
+    if (linenb < 0) {
+        if ((len + 2) > size) {
+            return 0;
+        }
+        memcpy (buffer, line, len);
+        n = len;
+    } else {
+        char number[10];
+        size_t digits = format_number (linenb, number);
+        uint8_t checksum = 'N' ^ ' ';
+        //N, space, *, 3 digits of checksum, \n and 0
+        if ((len + digits + 8) > size) {
+            return 0;
+        }
+        buffer[n++] = 'N';
+        for (size_t i = 0; i < digits; i++) {
+            checksum ^= (uint8_t)number[i];
+            buffer[n++] = number[i];
+        }
+        buffer[n++] = ' ';
+        for (size_t i = 0; i < len; i++) {
+            checksum ^= (uint8_t)line[i];
+            buffer[n++] = line[i];
+        }
+        buffer[n++] = '*';
+        n += format_number (checksum, &buffer[n]);
+    }
+    buffer[n++] = '\n';
+    buffer[n] = '\0';
+    return n;
+}
+#endif //USE_AS_UPDATER_ONLY
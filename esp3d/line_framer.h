@@ -0,0 +1,39 @@
+/*
+  line_framer.h - ESP3D gcode line numbering class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _LINE_FRAMER_H
+#define _LINE_FRAMER_H
+#include <Arduino.h>
+#include "config.h"
+
+//N<line> <gcode>*<checksum>\n
+#define LINE_FRAMER_SIZE 256
+
+//Write line ready to be sent to printer in caller buffer, in one pass:
+//number is formatted without String and checksum is computed while copying
+class LineFramer
+{
+public:
+    //linenb -1 means no number and no checksum, only end of line is added
+    //buffer is null terminated, return line size or 0 if it does not fit
+    static size_t frame (char * buffer, size_t size, const char * line, size_t len, int32_t linenb);
+};
+
+#endif //_LINE_FRAMER_H
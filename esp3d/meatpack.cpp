@@ -0,0 +1,233 @@
+/*
+  meatpack.cpp - ESP3D MeatPack gcode packing class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#include "espcom.h"
+#include "webinterface.h"
+#include "serial_query.h"
+#include "json_writer.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#endif
+
+//commands follow two 0xFF
+#define MEATPACK_SIGNAL 0xFF
+#define MEATPACK_ENABLE 0xFB
+#define MEATPACK_DISABLE 0xFA
+#define MEATPACK_RESET 0xF9
+//half byte of a char sent as it is
+#define MEATPACK_LITERAL 0x0F
+
+bool MeatPack::_enabled = true;
+bool MeatPack::_active = false;
+meatpack_state MeatPack::_state = MEATPACK_UNKNOWN;
+uint32_t MeatPack::_request_time = 0;
+int16_t MeatPack::_pending = -1;
+uint32_t MeatPack::_bytes_in = 0;
+uint32_t MeatPack::_bytes_out = 0;
+
+//data port hosts may pack themselves or use binary transfer,
+//so link is left as it is while one is connected
+static bool data_port_used()
+{
+#ifdef TCP_IP_DATA_FEATURE
+    return ESPCOM::hasTCPClient();
+#else
+    return false;
+#endif
+}
+
+//0-9 . space \n G X
+static uint8_t pack_index (uint8_t c)
+{
+    if ((c >= '0') && (c <= '9')) {
+        return c - '0';
+    }
+    switch (c) {
+    case '.':
+        return 10;
+    case ' ':
+        return 11;
+    case '\n':
+        return 12;
+    case 'G':
+        return 13;
+    case 'X':
+        return 14;
+    default:
+        return MEATPACK_LITERAL;
+    }
+}
+
+size_t MeatPack::encode (const uint8_t * data, size_t len, uint8_t * out, size_t size, size_t & used)
+{
+    size_t n = 0;
+    used = 0;
+    //a pair takes 3 bytes at most
+    while ((used < len) && ((n + 3) <= size)) {
+        uint8_t c = data[used++];
+        if (_pending < 0) {
+            //printer ignores other half of a byte starting by end of line
+            if (c == '\n') {
+                out[n++] = pack_index (c);
+            } else {
+                _pending = c;
+            }
+            continue;
+        }
+        uint8_t first = pack_index (_pending);
+        uint8_t second = pack_index (c);
+        out[n++] = (second << 4) | first;
+        if (first == MEATPACK_LITERAL) {
+            out[n++] = _pending;
+        }
+        if (second == MEATPACK_LITERAL) {
+            out[n++] = c;
+        }
+        _pending = -1;
+    }
+    _bytes_in += used;
+    _bytes_out += n;
+    return n;
+}
+
+//commands are never packed
+bool MeatPack::sendCommand (uint8_t command)
+{
+    uint8_t signal[3] = {MEATPACK_SIGNAL, MEATPACK_SIGNAL, command};
+    _active = false;
+    if (ESPCOM::write (DEFAULT_PRINTER_PIPE, signal, 3) != 3) {
+        return false;
+    }
+    //char waiting for its pair goes as it is
+    if (_pending >= 0) {
+        uint8_t c = _pending;
+        _pending = -1;
+        ESPCOM::write (DEFAULT_PRINTER_PIPE, &c, 1);
+    }
+    _active = (command == MEATPACK_ENABLE);
+    return true;
+}
+
+//printer answers [MP] PV01 ON ESP (or OFF) to any command
+void MeatPack::update (const char * line, size_t len)
+{
+    (void)len;
+    if (strncmp (line, "[MP]", 4) == 0) {
+        if (strstr (line, " ON")) {
+            _active = true;
+            _state = MEATPACK_ON;
+        } else if (_enabled && (_state == MEATPACK_WAITING)) {
+            //printer knows MeatPack so it can unpack from now
+            if (data_port_used() || !sendCommand (MEATPACK_ENABLE)) {
+                _state = MEATPACK_UNKNOWN;
+            } else {
+                _state = MEATPACK_ON;
+            }
+        } else {
+            _active = false;
+            _pending = -1;
+            //suspended packing is asked again later
+            if (_state != MEATPACK_UNKNOWN) {
+                _state = MEATPACK_OFF;
+            }
+        }
+        log_esp3d("MeatPack %s", _active ? "on" : "off");
+        return;
+    }
+    //printer restarted, it does not unpack anymore
+    if (strcmp (line, "start") == 0) {
+        _active = false;
+        _pending = -1;
+        _state = MEATPACK_UNKNOWN;
+    }
+}
+
+//ask printer when nobody is sending a line to it
+void MeatPack::poll()
+{
+    if (_state == MEATPACK_WAITING) {
+        if ((millis() - _request_time) > MEATPACK_TIMEOUT) {
+            log_esp3d("No MeatPack on printer");
+            _state = MEATPACK_UNSUPPORTED;
+        }
+        return;
+    }
+    if (!_enabled || (_state != MEATPACK_UNKNOWN) || (CONFIG::GetFirmwareTarget() != MARLIN)) {
+        return;
+    }
+    if (web_interface->blockserial || serial_query.active()) {
+        return;
+    }
+#ifndef USE_AS_UPDATER_ONLY
+    if (gcode_streamer.started()) {
+        return;
+    }
+#endif
+    if (data_port_used()) {
+        return;
+    }
+    //reset turns packing off, then end of line closes what printer
+    //got if it does not know MeatPack
+    if (!sendCommand (MEATPACK_RESET)) {
+        return;
+    }
+    ESPCOM::print ("\n", DEFAULT_PRINTER_PIPE);
+    _request_time = millis();
+    _state = MEATPACK_WAITING;
+}
+
+void MeatPack::setEnabled (bool enabled)
+{
+    _enabled = enabled;
+    if (!enabled && _active) {
+        sendCommand (MEATPACK_DISABLE);
+        _state = MEATPACK_OFF;
+    } else if (enabled && ((_state == MEATPACK_OFF) || (_state == MEATPACK_UNSUPPORTED))) {
+        _state = MEATPACK_UNKNOWN;
+    }
+}
+
+void MeatPack::suspend()
+{
+    if (_active) {
+        sendCommand (MEATPACK_DISABLE);
+        _state = MEATPACK_UNKNOWN;
+    }
+}
+
+void MeatPack::print (tpipe output, ESPResponseStream  *espresponse)
+{
+    static const char * const states[] = {"unknown", "waiting", "on", "off", "unsupported"};
+    JsonWriter writer (output, espresponse);
+    writer.print (F ("{\"meatpack\":\""));
+    writer.print (states[_state]);
+    writer.print (F ("\",\"enabled\":\""));
+    writer.print (_enabled ? "yes" : "no");
+    writer.print (F ("\",\"in\":\""));
+    writer.print ((int)_bytes_in);
+    writer.print (F ("\",\"out\":\""));
+    writer.print ((int)_bytes_out);
+    writer.print (F ("\"}"));
+    writer.println ("");
+}
+#endif //MEATPACK_FEATURE
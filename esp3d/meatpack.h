@@ -0,0 +1,68 @@
+/*
+  meatpack.h - ESP3D MeatPack gcode packing class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _MEATPACK_H
+#define _MEATPACK_H
+#include <Arduino.h>
+#include "config.h"
+
+//no answer to MeatPack reset during this time means printer does not have it
+#define MEATPACK_TIMEOUT 2000
+
+typedef enum {
+    MEATPACK_UNKNOWN = 0,
+    MEATPACK_WAITING,
+    MEATPACK_ON,
+    MEATPACK_OFF,
+    MEATPACK_UNSUPPORTED
+} meatpack_state;
+
+//MeatPack puts two of most used gcode chars (digits . space new line G X)
+//in one byte, any other char goes as it is after a 0xF half byte.
+//Printer is asked once it is idle and again after it restarts,
+//data are sent as they are until it answers it unpacks
+class MeatPack
+{
+public:
+    static void update (const char * line, size_t len);
+    static void poll();
+    static void setEnabled (bool enabled);
+    //stop packing until printer is idle again, for binary transfer
+    static void suspend();
+    static bool active()
+    {
+        return _active;
+    };
+    //pack data in out, used is number of data bytes taken, return number of bytes in out
+    //out must hold at least 3 bytes, a char without its pair is kept for next call
+    static size_t encode (const uint8_t * data, size_t len, uint8_t * out, size_t size, size_t & used);
+    static void print (tpipe output, ESPResponseStream  *espresponse = NULL);
+private:
+    static bool _enabled;
+    static bool _active;
+    static meatpack_state _state;
+    static uint32_t _request_time;
+    static int16_t _pending;
+    static uint32_t _bytes_in;
+    static uint32_t _bytes_out;
+    static bool sendCommand (uint8_t command);
+};
+
+#endif //_MEATPACK_H
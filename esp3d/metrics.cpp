@@ -0,0 +1,186 @@
+/*
+  metrics.cpp - ESP3D runtime metrics class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "metrics.h"
+#include "json_writer.h"
+#include "uart_fanout.h"
+#include "scheduler.h"
+
+uint32_t Metrics::_counters[METRIC_COUNTERS];
+uint32_t Metrics::_gauges[METRIC_GAUGES];
+metric_histogram_data Metrics::_histograms[METRIC_HISTOGRAMS];
+
+//100us to 10s
+const uint32_t metrics_bounds[METRICS_BUCKETS - 1] PROGMEM = {100, 1000, 10000, 100000, 1000000, 10000000};
+
+const char counter_uart_rx[] PROGMEM = "esp3d_uart_rx_bytes_total";
+const char counter_uart_tx[] PROGMEM = "esp3d_uart_tx_bytes_total";
+const char counter_resends[] PROGMEM = "esp3d_resends_total";
+const char counter_eeprom[] PROGMEM = "esp3d_eeprom_commits_total";
+const char counter_web_commands[] PROGMEM = "esp3d_web_commands_total";
+const char counter_uart_overruns[] PROGMEM = "esp3d_uart_rx_overruns_total";
+const char counter_uart_errors[] PROGMEM = "esp3d_uart_rx_errors_total";
+const char counter_minifier_in[] PROGMEM = "esp3d_minifier_in_bytes_total";
+const char counter_minifier_out[] PROGMEM = "esp3d_minifier_out_bytes_total";
+const char * const counter_names[METRIC_COUNTERS] PROGMEM = {
+    counter_uart_rx, counter_uart_tx, counter_resends, counter_eeprom, counter_web_commands,
+    counter_uart_overruns, counter_uart_errors, counter_minifier_in, counter_minifier_out
+};
+
+const char gauge_heap[] PROGMEM = "esp3d_free_heap_min_bytes";
+const char gauge_pool[] PROGMEM = "esp3d_uart_pool_high_chunks";
+const char gauge_tcp_rx[] PROGMEM = "esp3d_tcp_rx_high_bytes";
+const char gauge_query[] PROGMEM = "esp3d_query_queue_high";
+const char gauge_uart_rx_buffer[] PROGMEM = "esp3d_uart_rx_buffer_bytes";
+const char gauge_uart_rx_high[] PROGMEM = "esp3d_uart_rx_high_bytes";
+const char * const gauge_names[METRIC_GAUGES] PROGMEM = {
+    gauge_heap, gauge_pool, gauge_tcp_rx, gauge_query, gauge_uart_rx_buffer, gauge_uart_rx_high
+};
+
+const char histogram_loop[] PROGMEM = "esp3d_loop_time_us";
+const char histogram_web_handler[] PROGMEM = "esp3d_web_handler_time_us";
+const char histogram_web_command[] PROGMEM = "esp3d_web_command_time_us";
+const char histogram_flash[] PROGMEM = "esp3d_flash_write_time_us";
+const char histogram_notification[] PROGMEM = "esp3d_notification_time_us";
+const char * const histogram_names[METRIC_HISTOGRAMS] PROGMEM = {
+    histogram_loop, histogram_web_handler, histogram_web_command, histogram_flash, histogram_notification
+};
+
+const char fanout_parser[] PROGMEM = "parser";
+const char fanout_websocket[] PROGMEM = "websocket";
+const char * const fanout_names[FANOUT_TCP] PROGMEM = {
+    fanout_parser, fanout_websocket
+};
+
+void Metrics::observe (metric_histogram id, uint32_t us)
+{
+    metric_histogram_data & histogram = _histograms[id];
+    uint8_t i = 0;
+    while ((i < (METRICS_BUCKETS - 1)) && (us > pgm_read_dword(&metrics_bounds[i]))) {
+        i++;
+    }
+    histogram.buckets[i]++;
+    histogram.count++;
+    histogram.sum += us;
+}
+
+//printf of 64 bits is not available everywhere
+static const char * uint64_to_str (uint64_t value, char * buffer, size_t size)
+{
+    char * p = &buffer[size - 1];
+    *p = '\0';
+    do {
+        *--p = '0' + (value % 10);
+        value /= 10;
+    } while ((value > 0) && (p > buffer));
+    return p;
+}
+
+static void print_metric (JsonWriter & writer, const char * name, const char * type)
+{
+    writer.print (F ("# TYPE "));
+    writer.print (FPSTR (name));
+    writer.print (" ");
+    writer.print (type);
+    //prometheus lines end with \n only
+    writer.print ("\n");
+}
+
+static void print_value (JsonWriter & writer, const char * name, const char * suffix, const char * label, uint64_t value)
+{
+    char buffer[21];
+    writer.print (FPSTR (name));
+    writer.print (suffix);
+    writer.print (label);
+    writer.print (" ");
+    writer.print (uint64_to_str (value, buffer, sizeof (buffer)));
+    writer.print ("\n");
+}
+
+//Prometheus text format
+void Metrics::print (tpipe output, ESPResponseStream  *espresponse)
+{
+    JsonWriter writer (output, espresponse);
+    char label[32];
+    for (uint8_t i = 0; i < METRIC_COUNTERS; i++) {
+        const char * name = (const char *)pgm_read_ptr (&counter_names[i]);
+        print_metric (writer, name, "counter");
+        print_value (writer, name, "", "", _counters[i]);
+    }
+    for (uint8_t i = 0; i < METRIC_GAUGES; i++) {
+        const char * name = (const char *)pgm_read_ptr (&gauge_names[i]);
+        print_metric (writer, name, "gauge");
+        print_value (writer, name, "", "", _gauges[i]);
+    }
+    for (uint8_t i = 0; i < METRIC_HISTOGRAMS; i++) {
+        const char * name = (const char *)pgm_read_ptr (&histogram_names[i]);
+        metric_histogram_data & histogram = _histograms[i];
+        uint32_t total = 0;
+        print_metric (writer, name, "histogram");
+        for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+            //buckets are cumulative
+            total += histogram.buckets[b];
+            if (b < (METRICS_BUCKETS - 1)) {
+                snprintf (label, sizeof (label), "{le=\"%lu\"}", (unsigned long)pgm_read_dword (&metrics_bounds[b]));
+            } else {
+                strcpy (label, "{le=\"+Inf\"}");
+            }
+            print_value (writer, name, "_bucket", label, total);
+        }
+        print_value (writer, name, "_sum", "", histogram.sum);
+        print_value (writer, name, "_count", "", histogram.count);
+    }
+    //time used by each scheduler task
+    static const char task_runs[] PROGMEM = "esp3d_task_runs_total";
+    static const char task_time[] PROGMEM = "esp3d_task_time_us_total";
+    static const char task_max[] PROGMEM = "esp3d_task_max_us";
+    for (uint8_t d = 0; d < 3; d++) {
+        const char * name = (d == 0) ? task_runs : ((d == 1) ? task_time : task_max);
+        print_metric (writer, name, (d == 2) ? "gauge" : "counter");
+        for (uint8_t i = 0; i < Scheduler::count(); i++) {
+            const scheduler_task & task = Scheduler::task (i);
+            char task_name[16];
+            strncpy_P (task_name, task.name, sizeof (task_name));
+            task_name[sizeof (task_name) - 1] = '\0';
+            snprintf (label, sizeof (label), "{task=\"%s\"}", task_name);
+            print_value (writer, name, "", label, (d == 0) ? task.runs : ((d == 1) ? task.total_us : task.max_us));
+        }
+    }
+    //printer output sent to each consumer
+    static const char forwarded[] PROGMEM = "esp3d_fanout_forwarded_bytes_total";
+    static const char dropped[] PROGMEM = "esp3d_fanout_dropped_bytes_total";
+    for (uint8_t d = 0; d < 2; d++) {
+        const char * name = (d == 0) ? forwarded : dropped;
+        print_metric (writer, name, "counter");
+        for (uint8_t i = 0; i < FANOUT_CONSUMERS; i++) {
+            const fanout_counter & counter = UartFanout::counter (i);
+            if (i < FANOUT_TCP) {
+                char consumer[16];
+                strncpy_P (consumer, (const char *)pgm_read_ptr (&fanout_names[i]), sizeof (consumer));
+                consumer[sizeof (consumer) - 1] = '\0';
+                snprintf (label, sizeof (label), "{consumer=\"%s\"}", consumer);
+            } else {
+                snprintf (label, sizeof (label), "{consumer=\"tcp%d\"}", i - FANOUT_TCP);
+            }
+            print_value (writer, name, "", label, (d == 0) ? counter.forwarded : counter.dropped);
+        }
+    }
+}
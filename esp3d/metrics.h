@@ -0,0 +1,101 @@
+/*
+  metrics.h - ESP3D runtime metrics class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _METRICS_H
+#define _METRICS_H
+#include <Arduino.h>
+#include "config.h"
+
+//histogram buckets upper bounds in us, last one is +Inf
+#define METRICS_BUCKETS 7
+
+typedef enum {
+    METRIC_UART_RX_BYTES = 0,
+    METRIC_UART_TX_BYTES,
+    METRIC_RESENDS,
+    METRIC_EEPROM_COMMITS,
+    METRIC_WEB_COMMANDS,
+    METRIC_UART_RX_OVERRUNS,
+    METRIC_UART_RX_ERRORS,
+    METRIC_MINIFIER_IN_BYTES,
+    METRIC_MINIFIER_OUT_BYTES,
+    METRIC_COUNTERS
+} metric_counter;
+
+typedef enum {
+    METRIC_FREE_HEAP_MIN = 0,
+    METRIC_UART_POOL_HIGH,
+    METRIC_TCP_RX_HIGH,
+    METRIC_QUERY_QUEUE_HIGH,
+    METRIC_UART_RX_BUFFER,
+    METRIC_UART_RX_HIGH,
+    METRIC_GAUGES
+} metric_gauge;
+
+typedef enum {
+    METRIC_LOOP_TIME = 0,
+    METRIC_WEB_HANDLER_TIME,
+    METRIC_WEB_COMMAND_TIME,
+    METRIC_FLASH_WRITE_TIME,
+    METRIC_NOTIFICATION_TIME,
+    METRIC_HISTOGRAMS
+} metric_histogram;
+
+typedef struct {
+    uint32_t buckets[METRICS_BUCKETS];
+    uint32_t count;
+    uint64_t sum;
+} metric_histogram_data;
+
+//Counters, gauges and histograms in static arrays, updates are
+//cheap enough to stay on in production
+class Metrics
+{
+public:
+    static void add (metric_counter id, uint32_t value = 1)
+    {
+        _counters[id] += value;
+    };
+    static void set (metric_gauge id, uint32_t value)
+    {
+        _gauges[id] = value;
+    };
+    static void setMax (metric_gauge id, uint32_t value)
+    {
+        if (value > _gauges[id]) {
+            _gauges[id] = value;
+        }
+    };
+    //0 is used as not set yet
+    static void setMin (metric_gauge id, uint32_t value)
+    {
+        if ((_gauges[id] == 0) || (value < _gauges[id])) {
+            _gauges[id] = value;
+        }
+    };
+    static void observe (metric_histogram id, uint32_t us);
+    static void print (tpipe output, ESPResponseStream  *espresponse = NULL);
+private:
+    static uint32_t _counters[METRIC_COUNTERS];
+    static uint32_t _gauges[METRIC_GAUGES];
+    static metric_histogram_data _histograms[METRIC_HISTOGRAMS];
+};
+
+#endif //_METRICS_H
@@ -32,6 +32,7 @@
 #ifdef NOTIFICATION_FEATURE
 #include "notifications_service.h"
 #include "wificonf.h"
+#include "metrics.h"
 #if defined( ARDUINO_ARCH_ESP8266)
 #define USING_AXTLS
 #if defined(USING_AXTLS)
@@ -149,25 +150,29 @@ bool NotificationsService::sendMSG(const char * title, const char * message)
     if(!_started) {
         return false;
     }
+    bool res = false;
+    //TLS handshake is the slow part
+    uint32_t start = micros();
     if (!((strlen(title) == 0) && (strlen(message) == 0))) {
         switch(_notificationType) {
         case ESP_PUSHOVER_NOTIFICATION:
-            return sendPushoverMSG(title,message);
+            res = sendPushoverMSG(title,message);
             break;
         case ESP_EMAIL_NOTIFICATION:
-            return sendEmailMSG(title,message);
+            res = sendEmailMSG(title,message);
             break;
         case ESP_LINE_NOTIFICATION :
-            return sendLineMSG(title,message);
+            res = sendLineMSG(title,message);
             break;
         case ESP_IFTTT_NOTIFICATION :
-            return sendIFTTTMSG(title,message);
+            res = sendIFTTTMSG(title,message);
             break;
         default:
-            break;
+            return false;
         }
+        Metrics::observe (METRIC_NOTIFICATION_TIME, micros() - start);
     }
-    return false;
+    return res;
 }
 //Messages are currently limited to 1024 4-byte UTF-8 characters
 //but we do not do any check
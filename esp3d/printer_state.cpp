@@ -0,0 +1,378 @@
+/*
+  printer_state.cpp - ESP3D printer state cache class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "printer_state.h"
+#include "espcom.h"
+#include "webinterface.h"
+#include "serial_query.h"
+#include "json_writer.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#endif
+
+printer_temperature PrinterState::_extruders[PRINTER_STATE_EXTRUDERS];
+printer_temperature PrinterState::_bed;
+uint32_t PrinterState::_temperature_time = 0;
+float PrinterState::_position[PRINTER_STATE_AXES];
+uint32_t PrinterState::_position_time = 0;
+bool PrinterState::_sd_printing = false;
+uint32_t PrinterState::_sd_done = 0;
+uint32_t PrinterState::_sd_total = 0;
+uint32_t PrinterState::_sd_time = 0;
+bool PrinterState::_busy = false;
+uint32_t PrinterState::_busy_time = 0;
+uint16_t PrinterState::_poll_interval = 0;
+uint32_t PrinterState::_last_poll = 0;
+
+//serial line can be corrupted, such values are not kept
+static bool valid_value (float value)
+{
+    return isfinite (value) && (fabs (value) < PRINTER_STATE_VALUE_MAX);
+}
+
+//value with 2 decimals, never more than size - 1 chars
+static const char * format_value (char * buffer, size_t size, float value)
+{
+    if (!valid_value (value)) {
+        value = 0;
+    }
+    snprintf (buffer, size, "%.2f", value);
+    return buffer;
+}
+
+//value of <name>: when name starts a word, like T: but not B@:
+static bool read_value (const char * line, const char * end, const char * name, float & value, const char ** next = NULL)
+{
+    size_t size = strlen (name);
+    const char * p = line;
+    while ((p = strstr (p, name)) != NULL) {
+        if ((p + size) >= end) {
+            return false;
+        }
+        if ((p == line) || (p[-1] == ' ')) {
+            char * value_end;
+            value = strtod (p + size, &value_end);
+            if ((value_end != (p + size)) && valid_value (value)) {
+                if (next) {
+                    *next = value_end;
+                }
+                return true;
+            }
+        }
+        p += size;
+    }
+    return false;
+}
+
+//T:20.1 /0.0 B:20.3 /0.0 T0:20.1 /0.0 @:0 B@:0
+static bool read_temperature (const char * line, const char * end, const char * name, printer_temperature & temperature)
+{
+    const char * next;
+    float current;
+    if (!read_value (line, end, name, current, &next)) {
+        return false;
+    }
+    temperature.current = current;
+    while (*next == ' ') {
+        next++;
+    }
+    if (*next == '/') {
+        float target = strtod (next + 1, NULL);
+        if (valid_value (target)) {
+            temperature.target = target;
+        }
+    }
+    return true;
+}
+
+bool PrinterState::parseTemperatures (const char * line)
+{
+    const char * end = line + strlen (line);
+    bool found = read_temperature (line, end, "T:", _extruders[0]);
+    found |= read_temperature (line, end, "B:", _bed);
+    char name[4] = "T0:";
+    for (uint8_t i = 0; i < PRINTER_STATE_EXTRUDERS; i++) {
+        name[1] = '0' + i;
+        found |= read_temperature (line, end, name, _extruders[i]);
+    }
+    if (found) {
+        _temperature_time = millis();
+        publish (STATE_TEMPERATURES);
+    }
+    return found;
+}
+
+//X:0.00 Y:0.00 Z:0.00 E:0.00 Count X:0 Y:0 Z:0
+bool PrinterState::parsePosition (const char * line)
+{
+    const char * end = strstr (line, " Count");
+    if (!end) {
+        end = line + strlen (line);
+    }
+    float x, y, z;
+    if (!read_value (line, end, "X:", x) || !read_value (line, end, "Y:", y) || !read_value (line, end, "Z:", z)) {
+        return false;
+    }
+    _position[0] = x;
+    _position[1] = y;
+    _position[2] = z;
+    read_value (line, end, "E:", _position[3]);
+    _position_time = millis();
+    publish (STATE_POSITION);
+    return true;
+}
+
+//<Idle|MPos:0.000,0.000,0.000|FS:0,0> or <Idle,MPos:0.000,0.000,0.000,...>
+bool PrinterState::parseGrblStatus (const char * line)
+{
+    if (line[0] != '<') {
+        return false;
+    }
+    _busy = (strncmp (line + 1, "Idle", 4) != 0);
+    _busy_time = millis();
+    publish (STATE_BUSY);
+    const char * p = strstr (line, "MPos:");
+    if (!p) {
+        p = strstr (line, "WPos:");
+    }
+    if (p) {
+        p += 5;
+        for (uint8_t i = 0; i < 3; i++) {
+            char * next;
+            float value = strtod (p, &next);
+            if (valid_value (value)) {
+                _position[i] = value;
+            }
+            p = (*next == ',') ? next + 1 : next;
+        }
+        _position_time = millis();
+        publish (STATE_POSITION);
+    }
+    return true;
+}
+
+bool PrinterState::parseSDProgress (const char * line)
+{
+    const char * p;
+    //Marlin and Repetier
+    if ((p = strstr (line, "SD printing byte ")) != NULL) {
+        char * next;
+        _sd_done = strtoul (p + 17, &next, 10);
+        _sd_total = (*next == '/') ? strtoul (next + 1, NULL, 10) : 0;
+        _sd_printing = true;
+    } else if ((strncmp (line, "Not SD printing", 15) == 0) || (strncmp (line, "Not currently playing", 21) == 0)) {
+        _sd_printing = false;
+    } else if ((strncmp (line, "file: ", 6) == 0) && ((p = strstr (line, " % complete")) != NULL)) {
+        //Smoothieware gives percentage only
+        while ((p > line) && (p[-1] != ' ')) {
+            p--;
+        }
+        _sd_done = strtoul (p, NULL, 10);
+        _sd_total = 100;
+        _sd_printing = true;
+    } else {
+        return false;
+    }
+    _sd_time = millis();
+    publish (STATE_SD);
+    return true;
+}
+
+//line is a printer answer, already classified and null terminated
+void PrinterState::update (const char * line, size_t len, const response_info & response)
+{
+    (void)len;
+    switch (response.type) {
+    case RESPONSE_BUSY:
+        _busy = true;
+        _busy_time = millis();
+        publish (STATE_BUSY);
+        return;
+    case RESPONSE_WAIT:
+    case RESPONSE_ACK:
+        _busy = false;
+        _busy_time = millis();
+        publish (STATE_BUSY);
+        break;
+    default:
+        break;
+    }
+    if (response.temperature) {
+        parseTemperatures (line);
+        return;
+    }
+    if (parseGrblStatus (line)) {
+        return;
+    }
+    //M114 answer, Smoothieware one starts with ok C:
+    if (((line[0] == 'X') || (strncmp (line, "ok C:", 5) == 0)) && parsePosition (line)) {
+        return;
+    }
+    parseSDProgress (line);
+}
+
+//give changed values to web clients, values are same strings as [ESP421]
+void PrinterState::publish (state_topic topic)
+{
+#ifdef STATE_PUSH_FEATURE
+    char value[STATE_PUSH_VALUE_SIZE];
+    char current[PRINTER_STATE_FLOAT_SIZE];
+    char target[PRINTER_STATE_FLOAT_SIZE];
+    size_t len = 0;
+    switch (topic) {
+    case STATE_TEMPERATURES:
+        len = snprintf (value, sizeof (value), "{\"e\":[");
+        for (uint8_t i = 0; (i < PRINTER_STATE_EXTRUDERS) && (len < sizeof (value)); i++) {
+            len += snprintf (value + len, sizeof (value) - len, "%s[\"%s\",\"%s\"]", (i > 0) ? "," : "", format_value (current, sizeof (current), _extruders[i].current), format_value (target, sizeof (target), _extruders[i].target));
+        }
+        if (len < sizeof (value)) {
+            len += snprintf (value + len, sizeof (value) - len, "],\"b\":[\"%s\",\"%s\"]}", format_value (current, sizeof (current), _bed.current), format_value (target, sizeof (target), _bed.target));
+        }
+        break;
+    case STATE_POSITION: {
+        static const char * const axes[PRINTER_STATE_AXES] = {"x", "y", "z", "e"};
+        for (uint8_t i = 0; (i < PRINTER_STATE_AXES) && (len < sizeof (value)); i++) {
+            len += snprintf (value + len, sizeof (value) - len, "%s\"%s\":\"%s\"", (i > 0) ? "," : "{", axes[i], format_value (current, sizeof (current), _position[i]));
+        }
+        if (len < sizeof (value)) {
+            len += snprintf (value + len, sizeof (value) - len, "}");
+        }
+    }
+    break;
+    case STATE_SD:
+        len = snprintf (value, sizeof (value), "{\"printing\":\"%s\",\"done\":\"%u\",\"total\":\"%u\"}", _sd_printing ? "yes" : "no", (unsigned int)_sd_done, (unsigned int)_sd_total);
+        break;
+    case STATE_BUSY:
+        len = snprintf (value, sizeof (value), "\"%s\"", _busy ? "yes" : "no");
+        break;
+    default:
+        return;
+    }
+    //truncated value is not valid json, keep previous one
+    if (len >= sizeof (value)) {
+        return;
+    }
+    StatePush::set (topic, value);
+#else
+    (void)topic;
+#endif
+}
+
+//one poller for everybody, only when nobody else talks to printer
+//data port clients are left alone as they do not expect extra ok
+void PrinterState::poll()
+{
+    if ((_poll_interval == 0) || ((millis() - _last_poll) < (_poll_interval * 1000UL))) {
+        return;
+    }
+    if (web_interface->blockserial || serial_query.active()) {
+        return;
+    }
+#ifndef USE_AS_UPDATER_ONLY
+    if (gcode_streamer.started()) {
+        return;
+    }
+#endif
+#ifdef TCP_IP_DATA_FEATURE
+    if (ESPCOM::hasTCPClient()) {
+        return;
+    }
+#endif
+    _last_poll = millis();
+    if (CONFIG::GetFirmwareTarget() == GRBL) {
+        ESPCOM::print ("?", DEFAULT_PRINTER_PIPE);
+        return;
+    }
+    ESPCOM::println (F ("M105"), DEFAULT_PRINTER_PIPE);
+    if (_sd_printing) {
+        ESPCOM::println (F ("M27"), DEFAULT_PRINTER_PIPE);
+    }
+}
+
+static void print_age (JsonWriter & writer, uint32_t time)
+{
+    writer.print (F ("\"age\":\""));
+    if (time == 0) {
+        writer.print (-1);
+    } else {
+        writer.print ((int) (millis() - time));
+    }
+    writer.print ("\"");
+}
+
+static void print_float (JsonWriter & writer, const char * name, float value)
+{
+    char buffer[PRINTER_STATE_FLOAT_SIZE];
+    writer.print ("\"");
+    writer.print (name);
+    writer.print ("\":\"");
+    writer.print (format_value (buffer, sizeof (buffer), value));
+    writer.print ("\"");
+}
+
+static void print_temperature (JsonWriter & writer, const printer_temperature & temperature)
+{
+    writer.print ("{");
+    print_float (writer, "current", temperature.current);
+    writer.print (",");
+    print_float (writer, "target", temperature.target);
+    writer.print ("}");
+}
+
+//age is time in ms since data was seen, -1 if never
+void PrinterState::print (tpipe output, ESPResponseStream  *espresponse)
+{
+    JsonWriter writer (output, espresponse);
+    writer.print (F ("{\"temperatures\":{\"extruders\":["));
+    for (uint8_t i = 0; i < PRINTER_STATE_EXTRUDERS; i++) {
+        if (i > 0) {
+            writer.print (",");
+        }
+        print_temperature (writer, _extruders[i]);
+    }
+    writer.print (F ("],\"bed\":"));
+    print_temperature (writer, _bed);
+    writer.print (",");
+    print_age (writer, _temperature_time);
+    writer.print (F ("},\"position\":{"));
+    static const char * const axes[PRINTER_STATE_AXES] = {"x", "y", "z", "e"};
+    for (uint8_t i = 0; i < PRINTER_STATE_AXES; i++) {
+        print_float (writer, axes[i], _position[i]);
+        writer.print (",");
+    }
+    print_age (writer, _position_time);
+    writer.print (F ("},\"sd\":{\"printing\":\""));
+    writer.print (_sd_printing ? "yes" : "no");
+    writer.print (F ("\",\"done\":\""));
+    writer.print ((int)_sd_done);
+    writer.print (F ("\",\"total\":\""));
+    writer.print ((int)_sd_total);
+    writer.print (F ("\","));
+    print_age (writer, _sd_time);
+    writer.print (F ("},\"busy\":{\"state\":\""));
+    writer.print (_busy ? "yes" : "no");
+    writer.print (F ("\","));
+    print_age (writer, _busy_time);
+    writer.print (F ("},\"poll\":\""));
+    writer.print (_poll_interval);
+    writer.print (F ("\"}"));
+    writer.println ("");
+}
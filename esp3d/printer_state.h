@@ -0,0 +1,74 @@
+/*
+  printer_state.h - ESP3D printer state cache class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _PRINTER_STATE_H
+#define _PRINTER_STATE_H
+#include <Arduino.h>
+#include "config.h"
+#include "response_classifier.h"
+#include "state_push.h"
+
+#define PRINTER_STATE_EXTRUDERS 2
+//X, Y, Z, E
+#define PRINTER_STATE_AXES 4
+//values from printer output beyond this are taken as line corruption
+#define PRINTER_STATE_VALUE_MAX 100000
+//-99999.99 and null
+#define PRINTER_STATE_FLOAT_SIZE 12
+
+typedef struct {
+    float current;
+    float target;
+} printer_temperature;
+
+//Latest temperatures, position, SD progress and busy state seen in
+//printer output, so they can be given without asking the printer
+class PrinterState
+{
+public:
+    static void update (const char * line, size_t len, const response_info & response);
+    static void poll();
+    static void setPollInterval (uint16_t seconds)
+    {
+        _poll_interval = seconds;
+    };
+    static void print (tpipe output, ESPResponseStream  *espresponse = NULL);
+private:
+    static printer_temperature _extruders[PRINTER_STATE_EXTRUDERS];
+    static printer_temperature _bed;
+    static uint32_t _temperature_time;
+    static float _position[PRINTER_STATE_AXES];
+    static uint32_t _position_time;
+    static bool _sd_printing;
+    static uint32_t _sd_done;
+    static uint32_t _sd_total;
+    static uint32_t _sd_time;
+    static bool _busy;
+    static uint32_t _busy_time;
+    static uint16_t _poll_interval;
+    static uint32_t _last_poll;
+    static bool parseTemperatures (const char * line);
+    static bool parsePosition (const char * line);
+    static bool parseGrblStatus (const char * line);
+    static bool parseSDProgress (const char * line);
+    static void publish (state_topic topic);
+};
+
+#endif //_PRINTER_STATE_H
@@ -0,0 +1,170 @@
+/*
+  response_classifier.cpp - ESP3D printer response classifier class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "response_classifier.h"
+
+//number follows prefix
+#define RULE_NUMBER 1
+//no temperature or ESP command in rest of line
+#define RULE_FINAL 2
+
+#define RULE(prefix, type, flags) {prefix, sizeof(prefix) - 1, type, flags}
+
+typedef struct {
+    const char * prefix;
+    uint8_t size;
+    response_type type;
+    uint8_t flags;
+} response_rule;
+
+typedef struct {
+    const response_rule * rules;
+    bool numbered_ack;
+    bool lowercase_esp;
+} response_profile;
+
+//Marlin / MarlinKimbra and unknown firmware
+//ok can be followed by temperatures, or by N<line> with ADVANCED_OK
+static const response_rule marlin_rules[] = {
+    RULE("ok", RESPONSE_ACK, RULE_NUMBER),
+    RULE("Resend:", RESPONSE_RESEND, RULE_NUMBER | RULE_FINAL),
+    RULE("wait", RESPONSE_WAIT, RULE_FINAL),
+    RULE("echo:", RESPONSE_ECHO, 0),
+    RULE("Error:", RESPONSE_ERROR, 0),
+    {NULL, 0, RESPONSE_NONE, 0}
+};
+
+//Repetier acks numbered lines with "ok <line>"
+//and never stops sending wait / busy:
+static const response_rule repetier_rules[] = {
+    RULE("ok", RESPONSE_ACK, RULE_NUMBER | RULE_FINAL),
+    RULE("wait", RESPONSE_WAIT, RULE_FINAL),
+    RULE("busy:", RESPONSE_BUSY, RULE_FINAL),
+    RULE("skip", RESPONSE_SKIP, RULE_NUMBER | RULE_FINAL),
+    RULE("Resend:", RESPONSE_RESEND, RULE_NUMBER | RULE_FINAL),
+    RULE("echo:", RESPONSE_ECHO, 0),
+    RULE("Error:", RESPONSE_ERROR, 0),
+    {NULL, 0, RESPONSE_NONE, 0}
+};
+
+static const response_rule smoothie_rules[] = {
+    RULE("ok", RESPONSE_ACK, RULE_NUMBER),
+    RULE("rs ", RESPONSE_RESEND, RULE_NUMBER | RULE_FINAL),
+    RULE("wait", RESPONSE_WAIT, RULE_FINAL),
+    RULE("echo:", RESPONSE_ECHO, 0),
+    RULE("Error:", RESPONSE_ERROR, 0),
+    RULE("!!", RESPONSE_ERROR, 0),
+    {NULL, 0, RESPONSE_NONE, 0}
+};
+
+static const response_rule grbl_rules[] = {
+    RULE("ok", RESPONSE_ACK, 0),
+    RULE("wait", RESPONSE_WAIT, RULE_FINAL),
+    RULE("error:", RESPONSE_ERROR, RULE_NUMBER),
+    RULE("ALARM:", RESPONSE_ERROR, RULE_NUMBER),
+    {NULL, 0, RESPONSE_NONE, 0}
+};
+
+static const response_profile marlin_profile = {marlin_rules, false, false};
+static const response_profile repetier_profile = {repetier_rules, true, false};
+static const response_profile smoothie_profile = {smoothie_rules, false, true};
+static const response_profile grbl_profile = {grbl_rules, false, false};
+
+static const response_profile * current_profile = &marlin_profile;
+
+void ResponseClassifier::setFirmware(uint8_t fw)
+{
+    switch (fw) {
+    case REPETIER4DV:
+    case REPETIER:
+        current_profile = &repetier_profile;
+        break;
+    case SMOOTHIEWARE:
+        current_profile = &smoothie_profile;
+        break;
+    case GRBL:
+        current_profile = &grbl_profile;
+        break;
+    default:
+        current_profile = &marlin_profile;
+        break;
+    }
+}
+
+bool ResponseClassifier::ackHasLineNumber()
+{
+    return current_profile->numbered_ack;
+}
+
+//" 12", "N12", ":12" ... return -1 if no number
+static int32_t parse_number(const char * p)
+{
+    while ((*p == ' ') || (*p == ':') || (*p == 'N')) {
+        p++;
+    }
+    if (!isDigit(*p)) {
+        return -1;
+    }
+    return atol(p);
+}
+
+void ResponseClassifier::classify(const char * line, size_t len, response_info & response)
+{
+    response.type = RESPONSE_NONE;
+    response.number = -1;
+    response.temperature = false;
+    response.data = NULL;
+    response.size = 0;
+    const response_rule * rule = current_profile->rules;
+    while (rule->prefix && ((rule->size > len) || (strncmp(line, rule->prefix, rule->size) != 0))) {
+        rule++;
+    }
+    if (rule->prefix) {
+        response.type = rule->type;
+        if (rule->flags & RULE_NUMBER) {
+            response.number = parse_number(line + rule->size);
+        }
+        //save time no need to continue
+        if (rule->flags & RULE_FINAL) {
+            return;
+        }
+    }
+    //look for temperatures and ESP command at once
+    for (size_t i = 0; i < len; i++) {
+        char c = line[i];
+        if (c == ':') {
+            if ((i > 0) && ((line[i - 1] == 'T') || (line[i - 1] == 'B'))) {
+                response.temperature = true;
+            }
+        } else if ((c == '[') && (response.type != RESPONSE_ESP_COMMAND) && (i < strlen("echo: ")) && ((i + 4) < len)) {
+            //[ESPxxx] can be after an echo: only
+            if ((strncmp(&line[i + 1], "ESP", 3) == 0) || (current_profile->lowercase_esp && (strncmp(&line[i + 1], "esp", 3) == 0))) {
+                const char * end = (const char *)memchr(&line[i + 4], ']', len - (i + 4));
+                if (end) {
+                    response.type = RESPONSE_ESP_COMMAND;
+                    response.number = atoi(&line[i + 4]);
+                    response.data = end + 1;
+                    response.size = len - ((end + 1) - line);
+                }
+            }
+        }
+    }
+}
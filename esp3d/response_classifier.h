@@ -0,0 +1,59 @@
+/*
+  response_classifier.h - ESP3D printer response classifier class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _RESPONSE_CLASSIFIER_H
+#define _RESPONSE_CLASSIFIER_H
+#include <Arduino.h>
+
+typedef enum {
+    RESPONSE_NONE = 0,
+    RESPONSE_ACK,           //ok, number is acknowledged line if any
+    RESPONSE_WAIT,          //printer is idle
+    RESPONSE_BUSY,          //printer is processing
+    RESPONSE_SKIP,          //line already received, number is skipped line
+    RESPONSE_RESEND,        //number is requested line
+    RESPONSE_ESP_COMMAND,   //number is command id, data is parameters
+    RESPONSE_ECHO,
+    RESPONSE_ERROR
+} response_type;
+
+typedef struct {
+    response_type type;
+    int32_t number;
+    //line has temperatures (T: or B:)
+    bool temperature;
+    //parameters of ESP command, points inside classified line
+    const char * data;
+    size_t size;
+} response_info;
+
+//Classify printer answers in one pass using the rules
+//of current firmware target
+class ResponseClassifier
+{
+public:
+    static void setFirmware(uint8_t fw);
+    //line must be null terminated, len is its length
+    static void classify(const char * line, size_t len, response_info & response);
+    //ok of a numbered line has the line number (Repetier)
+    static bool ackHasLineNumber();
+};
+
+#endif //_RESPONSE_CLASSIFIER_H
@@ -0,0 +1,88 @@
+/*
+  scheduler.cpp - ESP3D cooperative tasks scheduler class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "scheduler.h"
+
+scheduler_task Scheduler::_tasks[SCHEDULER_MAX_TASKS];
+uint8_t Scheduler::_count = 0;
+
+//tasks are kept sorted by priority
+bool Scheduler::add (const char * name, task_callback callback, uint8_t priority, uint32_t period)
+{
+    if ((_count >= SCHEDULER_MAX_TASKS) || !callback) {
+        return false;
+    }
+    uint8_t i = _count;
+    while ((i > 0) && (_tasks[i - 1].priority > priority)) {
+        _tasks[i] = _tasks[i - 1];
+        i--;
+    }
+    scheduler_task & task = _tasks[i];
+    task.name = name;
+    task.callback = callback;
+    task.priority = priority;
+    task.period = period;
+    task.last_run = millis();
+    task.runs = 0;
+    task.total_us = 0;
+    task.max_us = 0;
+    _count++;
+    return true;
+}
+
+//return duration in us
+uint32_t Scheduler::runTask (scheduler_task & task)
+{
+    uint32_t start = micros();
+    task.callback();
+    uint32_t duration = micros() - start;
+    task.last_run = millis();
+    task.runs++;
+    task.total_us += duration;
+    if (duration > task.max_us) {
+        task.max_us = duration;
+    }
+    return duration;
+}
+
+void Scheduler::run()
+{
+    uint32_t cycle_start = millis();
+    for (uint8_t i = 0; i < _count; i++) {
+        scheduler_task & task = _tasks[i];
+        if (task.period > 0) {
+            uint32_t elapsed = millis() - task.last_run;
+            if (elapsed < task.period) {
+                continue;
+            }
+            //cycle is already long, wait next one if deadline allows it
+            if (((millis() - cycle_start) > SCHEDULER_CYCLE_BUDGET) && (elapsed < (2 * task.period))) {
+                continue;
+            }
+        }
+        uint32_t duration = runTask (task);
+        //let bridge catch up after a slow task
+        if ((duration > SCHEDULER_BRIDGE_GAP) && (task.priority != TASK_PRIORITY_BRIDGE) &&
+                (_tasks[0].priority == TASK_PRIORITY_BRIDGE)) {
+            runTask (_tasks[0]);
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+  scheduler.h - ESP3D cooperative tasks scheduler class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _SCHEDULER_H
+#define _SCHEDULER_H
+#include <Arduino.h>
+#include "config.h"
+
+#define SCHEDULER_MAX_TASKS 10
+//periodic tasks may wait next cycle when cycle is longer than this (ms)
+#define SCHEDULER_CYCLE_BUDGET 20
+//bridge runs again after a task longer than this (us)
+#define SCHEDULER_BRIDGE_GAP 5000
+
+//priority 0 is reserved to bridge
+#define TASK_PRIORITY_BRIDGE 0
+#define TASK_PRIORITY_HIGH 1
+#define TASK_PRIORITY_NORMAL 2
+#define TASK_PRIORITY_LOW 3
+
+typedef void (*task_callback) ();
+
+typedef struct {
+    //PROGMEM string
+    const char * name;
+    task_callback callback;
+    uint8_t priority;
+    //ms between two runs, 0 means every cycle
+    uint32_t period;
+    uint32_t last_run;
+    uint32_t runs;
+    uint64_t total_us;
+    uint32_t max_us;
+} scheduler_task;
+
+//Tasks run by priority each cycle, bridge first and again after
+//any slow task, so serial stream is never starved for long
+class Scheduler
+{
+public:
+    static bool add (const char * name, task_callback callback, uint8_t priority, uint32_t period = 0);
+    static void run();
+    static uint8_t count()
+    {
+        return _count;
+    };
+    static const scheduler_task & task (uint8_t index)
+    {
+        return _tasks[index];
+    };
+private:
+    static scheduler_task _tasks[SCHEDULER_MAX_TASKS];
+    static uint8_t _count;
+    static uint32_t runTask (scheduler_task & task);
+};
+
+#endif //_SCHEDULER_H
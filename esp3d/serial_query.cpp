@@ -0,0 +1,143 @@
+/*
+  serial_query.cpp - ESP3D queued printer commands class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "serial_query.h"
+#include "espcom.h"
+#include "webinterface.h"
+#include "response_classifier.h"
+#include "metrics.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#endif
+
+SerialQuery serial_query;
+
+SerialQuery::SerialQuery()
+{
+    _head = 0;
+    _count = 0;
+    _active = false;
+    _status_count = 0;
+    _last_activity = 0;
+    _line_size = 0;
+    _start = 0;
+}
+
+//return false if queue is full
+bool SerialQuery::queue(const String & cmd, query_line_callback on_line, query_done_callback on_done, void * context)
+{
+    if (_count >= SERIAL_QUERY_QUEUE_SIZE) {
+        return false;
+    }
+    query_entry & entry = _queue[(_head + _count) % SERIAL_QUERY_QUEUE_SIZE];
+    entry.cmd = cmd;
+    entry.on_line = on_line;
+    entry.on_done = on_done;
+    entry.context = context;
+    _count++;
+    Metrics::setMax (METRIC_QUERY_QUEUE_HIGH, _count);
+    log_esp3d("Query %s queued", cmd.c_str());
+    return true;
+}
+
+//start next query when serial is free and check time out
+void SerialQuery::process()
+{
+    if (_active) {
+        if ((millis() - _last_activity) > SERIAL_QUERY_TIMEOUT) {
+            finish(QUERY_TIMEOUT);
+        }
+        return;
+    }
+    //wait end of uploads and of lines started by data port clients
+    if ((_count == 0) || web_interface->blockserial || !ESPCOM::printerLineFree()) {
+        return;
+    }
+#ifndef USE_AS_UPDATER_ONLY
+    if (gcode_streamer.started()) {
+        return;
+    }
+#endif
+    //printer line belongs to query until answer is complete,
+    //clients keep sending to socket meanwhile and wait their turn
+    _active = true;
+    _status_count = 0;
+    _line_size = 0;
+    _last_activity = millis();
+    _start = micros();
+    Metrics::add (METRIC_WEB_COMMANDS);
+    ESPCOM::println (_queue[_head].cmd, DEFAULT_PRINTER_PIPE);
+}
+
+//printer output, lines are assembled here
+void SerialQuery::feed(const uint8_t * data, size_t len)
+{
+    if (!_active) {
+        return;
+    }
+    _last_activity = millis();
+    for (size_t i = 0; (i < len) && _active; i++) {
+        if ((data[i] == '\n') || (data[i] == '\r')) {
+            if (_line_size > 0) {
+                _line[_line_size] = '\0';
+                handleLine();
+                _line_size = 0;
+            }
+        } else if (_line_size < (SERIAL_QUERY_LINE_SIZE - 1)) {
+            _line[_line_size++] = data[i];
+        }
+    }
+}
+
+void SerialQuery::handleLine()
+{
+    query_entry & entry = _queue[_head];
+    response_info response;
+    ResponseClassifier::classify (_line, _line_size, response);
+    //numbered ok are for lines sent by someone else
+    if (((response.type == RESPONSE_ACK) && (response.number == -1)) || (response.type == RESPONSE_WAIT)) {
+        entry.on_line (_line, _line_size, entry.context);
+        finish(QUERY_DONE);
+        return;
+    }
+    if (response.type != RESPONSE_ACK) {
+        entry.on_line (_line, _line_size, entry.context);
+    }
+    //too many temperatures, printer should be heating so do not wait the ok
+    if ((response.type == RESPONSE_BUSY) || response.temperature) {
+        _status_count++;
+        if (_status_count > SERIAL_QUERY_MAX_STATUS) {
+            finish(QUERY_BUSY);
+        }
+    }
+}
+
+void SerialQuery::finish(query_status status)
+{
+    query_entry & entry = _queue[_head];
+    log_esp3d("Query %s finished: %d", entry.cmd.c_str(), status);
+    Metrics::observe (METRIC_WEB_COMMAND_TIME, micros() - _start);
+    entry.on_done (status, entry.context);
+    entry.cmd = String();
+    _head = (_head + 1) % SERIAL_QUERY_QUEUE_SIZE;
+    _count--;
+    _active = false;
+}
@@ -0,0 +1,82 @@
+/*
+  serial_query.h - ESP3D queued printer commands class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _SERIAL_QUERY_H
+#define _SERIAL_QUERY_H
+#include <Arduino.h>
+#include "config.h"
+
+#define SERIAL_QUERY_QUEUE_SIZE 4
+#define SERIAL_QUERY_LINE_SIZE 128
+//no answer from printer during this time means end of answer
+#define SERIAL_QUERY_TIMEOUT 2000
+//printer is heating if it sends more temperatures than this
+#define SERIAL_QUERY_MAX_STATUS 5
+
+typedef enum {
+    QUERY_DONE = 0,
+    QUERY_TIMEOUT = 1,
+    QUERY_BUSY = 2,
+} query_status;
+
+//line is null terminated, context is the one given with the query
+typedef void (*query_line_callback) (const char * line, size_t len, void * context);
+typedef void (*query_done_callback) (query_status status, void * context);
+
+//Send commands to printer one at a time and collect answer lines
+//until ok/wait or time out, from main loop without waiting
+class SerialQuery
+{
+public:
+    SerialQuery();
+    bool queue(const String & cmd, query_line_callback on_line, query_done_callback on_done, void * context);
+    void process();
+    void feed(const uint8_t * data, size_t len);
+    bool active()
+    {
+        return _active;
+    };
+    uint8_t pending()
+    {
+        return _count;
+    };
+private:
+    struct query_entry {
+        String cmd;
+        query_line_callback on_line;
+        query_done_callback on_done;
+        void * context;
+    };
+    query_entry _queue[SERIAL_QUERY_QUEUE_SIZE];
+    uint8_t _head;
+    uint8_t _count;
+    bool _active;
+    uint8_t _status_count;
+    uint32_t _last_activity;
+    uint32_t _start;
+    char _line[SERIAL_QUERY_LINE_SIZE];
+    uint16_t _line_size;
+    void handleLine();
+    void finish(query_status status);
+};
+
+extern SerialQuery serial_query;
+
+#endif //_SERIAL_QUERY_H
@@ -0,0 +1,78 @@
+/*
+  spsc_ring.cpp - ESP3D lock-free single producer single consumer ring
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#ifdef SERIAL_TASK_FEATURE
+#include <string.h>
+#include "spsc_ring.h"
+
+//indexes are never wrapped, only masked when used
+SpscRing::SpscRing(uint8_t * buffer, size_t size) : _buffer(buffer), _size(size), _head(0), _tail(0)
+{
+}
+
+size_t SpscRing::free() const
+{
+    return _size - (_head.load(std::memory_order_relaxed) - _tail.load(std::memory_order_acquire));
+}
+
+size_t SpscRing::available() const
+{
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_relaxed);
+}
+
+size_t SpscRing::write(const uint8_t * data, size_t len)
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+    size_t room = _size - (head - _tail.load(std::memory_order_acquire));
+    if (len > room) {
+        len = room;
+    }
+    size_t pos = head & (_size - 1);
+    size_t first = _size - pos;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&_buffer[pos], data, first);
+    memcpy(_buffer, &data[first], len - first);
+    //data must be in buffer before consumer can see it
+    _head.store(head + len, std::memory_order_release);
+    return len;
+}
+
+size_t SpscRing::read(uint8_t * data, size_t len)
+{
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    size_t count = _head.load(std::memory_order_acquire) - tail;
+    if (len > count) {
+        len = count;
+    }
+    size_t pos = tail & (_size - 1);
+    size_t first = _size - pos;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(data, &_buffer[pos], first);
+    memcpy(&data[first], _buffer, len - first);
+    //room is given back only once data is copied
+    _tail.store(tail + len, std::memory_order_release);
+    return len;
+}
+#endif //SERIAL_TASK_FEATURE
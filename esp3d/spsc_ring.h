@@ -0,0 +1,48 @@
+/*
+  spsc_ring.h - ESP3D lock-free single producer single consumer ring
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _SPSC_RING_H
+#define _SPSC_RING_H
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+//Byte ring shared by two tasks without lock: only one task writes
+//and only one task reads, size must be a power of 2
+class SpscRing
+{
+public:
+    SpscRing(uint8_t * buffer, size_t size);
+    //producer side
+    size_t write(const uint8_t * data, size_t len);
+    size_t free() const;
+    //consumer side
+    size_t read(uint8_t * data, size_t len);
+    size_t available() const;
+private:
+    uint8_t * _buffer;
+    size_t _size;
+    //only changed by producer
+    std::atomic<size_t> _head;
+    //only changed by consumer
+    std::atomic<size_t> _tail;
+};
+
+#endif //_SPSC_RING_H
@@ -0,0 +1,145 @@
+/*
+  state_push.cpp - ESP3D state push class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#ifdef STATE_PUSH_FEATURE
+#include "state_push.h"
+#include "wificonf.h"
+#include "syncwebserver.h"
+
+//same order as state_topic
+static const char * const topic_names[STATE_TOPICS] = {"temp", "pos", "sd", "busy", "upload", "esp"};
+
+typedef struct {
+    bool connected;
+    //version of each topic last sent
+    uint16_t sent[STATE_TOPICS];
+    uint32_t last_send;
+    //grows when client does not take messages
+    uint16_t interval;
+} state_client;
+
+static state_client clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+//STATE:{"<topic>":<value>,...}
+static char frame[8 + (STATE_TOPICS * (STATE_PUSH_VALUE_SIZE + 12))];
+
+char StatePush::_values[STATE_TOPICS][STATE_PUSH_VALUE_SIZE];
+uint16_t StatePush::_versions[STATE_TOPICS];
+uint32_t StatePush::_last_health = 0;
+
+//value is JSON (object, array or quoted string), same value is ignored
+void StatePush::set (state_topic topic, const char * value)
+{
+    if (strcmp (_values[topic], value) == 0) {
+        return;
+    }
+    strncpy (_values[topic], value, STATE_PUSH_VALUE_SIZE - 1);
+    _values[topic][STATE_PUSH_VALUE_SIZE - 1] = '\0';
+    _versions[topic]++;
+    if (_versions[topic] == 0) {
+        _versions[topic] = 1;
+    }
+}
+
+//new client gets every topic already known
+void StatePush::connect (uint8_t num)
+{
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+        return;
+    }
+    memset (&clients[num], 0, sizeof (state_client));
+    clients[num].connected = true;
+    clients[num].interval = STATE_PUSH_INTERVAL;
+}
+
+void StatePush::disconnect (uint8_t num)
+{
+    if (num < WEBSOCKETS_SERVER_CLIENT_MAX) {
+        clients[num].connected = false;
+    }
+}
+
+void StatePush::updateHealth()
+{
+    char value[STATE_PUSH_VALUE_SIZE];
+    int32_t signal = -1;
+    if ((WiFi.getMode() == WIFI_STA) && wifi_config.WiFi_on) {
+        signal = wifi_config.getSignal (WiFi.RSSI ());
+    }
+    snprintf (value, sizeof (value), "{\"heap\":\"%u\",\"signal\":\"%d\",\"uptime\":\"%u\"}", (unsigned int)ESP.getFreeHeap(), (int)signal, (unsigned int) (millis() / 1000));
+    set (STATE_HEALTH, value);
+}
+
+//return 0 if client has nothing new
+size_t StatePush::buildFrame (uint8_t num, char * buffer, size_t size)
+{
+    size_t len = strlen (strcpy (buffer, "STATE:{"));
+    for (uint8_t i = 0; i < STATE_TOPICS; i++) {
+        if (_versions[i] == clients[num].sent[i]) {
+            continue;
+        }
+        int n = snprintf (buffer + len, size - len, "%s\"%s\":%s", (buffer[len - 1] == '{') ? "" : ",", topic_names[i], _values[i]);
+        if ((n <= 0) || ((size_t)n >= (size - len))) {
+            break;
+        }
+        len += n;
+    }
+    if (buffer[len - 1] == '{') {
+        return 0;
+    }
+    buffer[len++] = '}';
+    buffer[len] = '\0';
+    return len;
+}
+
+//called often, each client gets at most one message per its interval
+void StatePush::process()
+{
+    if (!socket_server) {
+        return;
+    }
+    if ((millis() - _last_health) >= STATE_PUSH_HEALTH_INTERVAL) {
+        _last_health = millis();
+        updateHealth();
+    }
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        state_client & client = clients[num];
+        if (!client.connected || ((millis() - client.last_send) < client.interval)) {
+            continue;
+        }
+        size_t len = buildFrame (num, frame, sizeof (frame));
+        if (len == 0) {
+            continue;
+        }
+        client.last_send = millis();
+        if (socket_server->sendTXT (num, frame, len)) {
+            memcpy (client.sent, _versions, sizeof (_versions));
+            client.interval = STATE_PUSH_INTERVAL;
+        } else {
+            //slow client: nothing is marked as sent, so next message
+            //will carry latest values of all topics changed meanwhile
+            client.interval *= 2;
+            if (client.interval > STATE_PUSH_MAX_INTERVAL) {
+                client.interval = STATE_PUSH_MAX_INTERVAL;
+            }
+        }
+    }
+}
+#endif //STATE_PUSH_FEATURE
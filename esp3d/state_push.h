@@ -0,0 +1,58 @@
+/*
+  state_push.h - ESP3D state push class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _STATE_PUSH_H
+#define _STATE_PUSH_H
+#include <Arduino.h>
+#include "config.h"
+
+//JSON value of one topic
+#define STATE_PUSH_VALUE_SIZE 96
+
+typedef enum {
+    STATE_TEMPERATURES = 0,
+    STATE_POSITION,
+    STATE_SD,
+    STATE_BUSY,
+    STATE_UPLOAD,
+    STATE_HEALTH,
+    STATE_TOPICS
+} state_topic;
+
+//Keep latest JSON value of each topic and send to each websocket client
+//only topics changed since its last message, as STATE:{"temp":...,"pos":...}
+//values changed several times between two messages are sent once
+class StatePush
+{
+public:
+    static void set (state_topic topic, const char * value);
+    static void connect (uint8_t num);
+    static void disconnect (uint8_t num);
+    static void process();
+private:
+    static char _values[STATE_TOPICS][STATE_PUSH_VALUE_SIZE];
+    //0 means never set
+    static uint16_t _versions[STATE_TOPICS];
+    static uint32_t _last_health;
+    static void updateHealth();
+    static size_t buildFrame (uint8_t num, char * frame, size_t size);
+};
+
+#endif //_STATE_PUSH_H
@@ -47,6 +47,19 @@
 #include "GenLinkedList.h"
 #include "command.h"
 #include "espcom.h"
+#include "serial_query.h"
+#include "upload_writer.h"
+#include "metrics.h"
+#include "state_push.h"
+#ifndef USE_AS_UPDATER_ONLY
+#include "gcode_streamer.h"
+#ifdef BINARY_TRANSFER_FEATURE
+#include "binary_transfer.h"
+#endif
+#ifdef GCODE_MINIFIER_FEATURE
+#include "gcode_minifier.h"
+#endif
+#endif
 
 #ifdef SSDP_FEATURE
 #ifdef ARDUINO_ARCH_ESP32
@@ -59,7 +72,7 @@
 //embedded response file if no files on SPIFFS
 #include "nofile.h"
 #include "syncwebserver.h"
-WebSocketsServer * socket_server;
+ESP3DWebSocketsServer * socket_server;
 
 
 #define ESP_ERROR_AUTHENTICATION 1
@@ -114,39 +127,144 @@ void cancelUpload(){
     }
 }
 
+#ifdef STATE_PUSH_FEATURE
+//upload progress for web clients, sent from upload handler
+//as scheduler does not run until upload is finished
+static void push_upload_state()
+{
+    static const char * const status_names[] = {"none", "failed", "cancelled", "done", "ongoing"};
+    HTTPUpload& upload = (web_interface->web_server).upload();
+    const char * filename = upload.filename.c_str();
+    char name[48];
+    size_t i = 0;
+    for (; (i < (sizeof (name) - 1)) && (filename[i] != '\0'); i++) {
+        char c = filename[i];
+        name[i] = ((c == '"') || (c == '\\')) ? '_' : c;
+    }
+    name[i] = '\0';
+    uint8_t status = web_interface->_upload_status;
+    if (status > UPLOAD_STATUS_ONGOING) {
+        status = UPLOAD_STATUS_NONE;
+    }
+    char value[STATE_PUSH_VALUE_SIZE];
+    snprintf (value, sizeof (value), "{\"file\":\"%s\",\"size\":\"%u\",\"status\":\"%s\"}", name, (unsigned int)upload.totalSize, status_names[status]);
+    StatePush::set (STATE_UPLOAD, value);
+    StatePush::process();
+}
+#endif
+
+#ifdef WS_DATA_FEATURE
+//level of each websocket client, checked once at handshake
+static level_authenticate_type ws_auth_level[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+static void ws_error (uint8_t num, int code, const char * st)
+{
+    String s = "ERROR:" + String(code) + ":";
+    s += st;
+    socket_server->sendTXT(num, s);
+}
+
+//each line of frame is a command: [ESPxxx] is executed and answered
+//on this client, others go to printer as data port lines do
+static void ws_command (uint8_t num, uint8_t * payload, size_t length)
+{
+    if (CONFIG::is_locked(FLAG_BLOCK_WSOCKET) || (num >= WEBSOCKETS_SERVER_CLIENT_MAX)) {
+        return;
+    }
+    //client sending commands is the active one
+    if (ESPCOM::current_socket_id != num) {
+        ESPCOM::current_socket_id = num;
+        String s = "ACTIVE_ID:" + String(num);
+        socket_server->broadcastTXT(s);
+    }
+    char * p = (char *)payload;
+    char * end = p + length;
+    while (p < end) {
+        char * eol = (char *)memchr (p, '\n', end - p);
+        if (!eol) {
+            eol = end;
+        }
+        char * line = p;
+        char * line_end = eol;
+        p = eol + 1;
+        while ((line < line_end) && isspace (*line)) {
+            line++;
+        }
+        while ((line_end > line) && isspace (line_end[-1])) {
+            line_end--;
+        }
+        if (line == line_end) {
+            continue;
+        }
+        //payload belongs to us during event
+        *line_end = '\0';
+        if (strncmp (line, "[ESP", 4) == 0) {
+            char * close = strchr (line, ']');
+            int cmd = atoi (line + 4);
+            if (close && (cmd != 0)) {
+                //same rule as /command: guest can only ask for [ESP800]
+                if ((ws_auth_level[num] == LEVEL_GUEST) && (cmd != 800)) {
+                    ws_error (num, ESP_ERROR_AUTHENTICATION, "Authentication failed");
+                    return;
+                }
+                COMMAND::execute_command (cmd, String (close + 1), WS_PIPE, ws_auth_level[num]);
+                continue;
+            }
+        }
+        if (ws_auth_level[num] == LEVEL_GUEST) {
+            ws_error (num, ESP_ERROR_AUTHENTICATION, "Authentication failed");
+            return;
+        }
+        if (!ESPCOM::pushWSLine (line, line_end - line)) {
+            ws_error (num, ESP_ERROR_BUFFER_OVERFLOW, "Error buffer overflow");
+            return;
+        }
+    }
+}
+#endif
+
 void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length)
 {
 
     switch(type) {
     case WStype_DISCONNECTED:
         //USE_SERIAL.printf("[%u] Disconnected!\n", num);
+        //failed handshake must not leave its cookie to next client of slot
+        socket_server->takeCookie (num);
+#ifdef WS_DATA_FEATURE
+        ESPCOM::resetWSClient (num);
+#endif
+#ifdef STATE_PUSH_FEATURE
+        StatePush::disconnect (num);
+#endif
         break;
     case WStype_CONNECTED: {
         //IPAddress ip = socket_server->remoteIP(num);
         //USE_SERIAL.printf("[%u] Connected from %d.%d.%d.%d url: %s\n", num, ip[0], ip[1], ip[2], ip[3], payload);
         String s = "CURRENT_ID:" + String(num);
         // send message to client
+        String cookie = socket_server->takeCookie (num);
         ESPCOM::current_socket_id = num;
         socket_server->sendTXT(ESPCOM::current_socket_id, s);
         s = "ACTIVE_ID:" + String(ESPCOM::current_socket_id);
         socket_server->broadcastTXT(s);
+#ifdef WS_DATA_FEATURE
+        //every client gets printer output, not only the last one
+        ESPCOM::resetWSClient (num);
+        if (num < WEBSOCKETS_SERVER_CLIENT_MAX) {
+            ws_auth_level[num] = web_interface->is_authenticated (cookie, socket_server->remoteIP (num));
+        }
+#endif
+#ifdef STATE_PUSH_FEATURE
+        StatePush::connect (num);
+#endif
     }
     break;
     case WStype_TEXT:
-        //USE_SERIAL.printf("[%u] get Text: %s\n", num, payload);
-
-        // send message to client
-        // webSocket.sendTXT(num, "message here");
-
-        // send data to all connected clients
-        // webSocket.broadcastTXT("message here");
-        break;
     case WStype_BIN:
-        //USE_SERIAL.printf("[%u] get binary length: %u\n", num, length);
-        //hexdump(payload, length);
-
-        // send message to client
-        // webSocket.sendBIN(num, payload, length);
+#ifdef WS_DATA_FEATURE
+        ws_command (num, payload, length);
+#endif
         break;
     default:
         break;
@@ -278,6 +396,7 @@ void handle_login()
                     smsg = F("Error: Cannot apply changes");
                     code = 500;
                 }
+                CONFIG::commit_settings (true);
             } else {
                 msg_alert_error=true;
                 smsg = F("Error: Incorrect password");
@@ -369,6 +488,11 @@ void handle_SSDP()
 }
 #endif
 
+//SPIFFS uploads are written by full buffers
+static UploadWriter upload_writer;
+//CRC32 of last successful upload, given back with files list
+static uint32_t upload_crc32 = 0;
+
 //SPIFFS files list and file commands///////////////////////////////////
 void handleFileList()
 {
@@ -577,6 +701,13 @@ void handleFileList()
     jsonfile+="],";
     jsonfile+="\"path\":\"" + path + "\",";
     jsonfile+="\"status\":\"" + status + "\",";
+    if (web_interface->_upload_status == UPLOAD_STATUS_SUCCESSFUL) {
+        char crc[9];
+        snprintf (crc, sizeof(crc), "%08lx", (unsigned long)upload_crc32);
+        jsonfile+="\"crc32\":\"";
+        jsonfile+=crc;
+        jsonfile+="\",";
+    }
     size_t totalBytes;
     size_t usedBytes;
 #if defined ( ARDUINO_ARCH_ESP8266)
@@ -605,6 +736,7 @@ void SPIFFSFileupload()
 {
     static FS_FILE fsUploadFile = (FS_FILE)0;
     static String filename;
+    static String crcargvalue;
     //get authentication status
     level_authenticate_type auth_level= web_interface->is_authenticated();
     //Guest cannot upload
@@ -622,6 +754,7 @@ void SPIFFSFileupload()
                 web_interface->_upload_status= UPLOAD_STATUS_ONGOING;
                 String upload_filename = upload.filename;
                 String  sizeargname  = upload_filename + "S";
+                String  crcargname  = upload_filename + "C";
                 if (upload_filename[0] != '/') filename = "/" + upload_filename;
                 else filename = upload.filename;
                 //according User or Admin the root is different as user is isolate to /user when admin has full access
@@ -636,6 +769,11 @@ void SPIFFSFileupload()
                 if (fsUploadFile ) {
                     fsUploadFile.close();
                 }
+                //optional CRC32 (hex) to check upload against
+                crcargvalue = "";
+                if ((web_interface->web_server).hasArg (crcargname.c_str()) ) {
+                    crcargvalue = (web_interface->web_server).arg (crcargname.c_str());
+                }
                 if ((web_interface->web_server).hasArg (sizeargname.c_str()) ) {
                     uint32_t filesize = (web_interface->web_server).arg (sizeargname.c_str()).toInt();
     #if defined ( ARDUINO_ARCH_ESP8266)
@@ -656,7 +794,7 @@ void SPIFFSFileupload()
                     //create file
                     fsUploadFile = SPIFFS.open(filename, SPIFFS_FILE_WRITE);
                     //check If creation succeed
-                    if (fsUploadFile) {
+                    if (fsUploadFile && upload_writer.begin (&fsUploadFile)) {
                         //if yes upload is started
                         web_interface->_upload_status= UPLOAD_STATUS_ONGOING;
                     } else {
@@ -672,7 +810,7 @@ void SPIFFSFileupload()
                 //check if file is available and no error
                 if(fsUploadFile && web_interface->_upload_status == UPLOAD_STATUS_ONGOING) {
                     //no error so write post date
-                    if (upload.currentSize != fsUploadFile.write(upload.buf, upload.currentSize)){
+                    if (!upload_writer.write (upload.buf, upload.currentSize)) {
                         web_interface->_upload_status=UPLOAD_STATUS_FAILED;
                         ESPCOM::println (F ("Error ESP write"), PRINTER_PIPE);
                         pushError(ESP_ERROR_FILE_WRITE, "File write failed");
@@ -687,10 +825,21 @@ void SPIFFSFileupload()
             } else if(upload.status == UPLOAD_FILE_END) {
                 //check if file is still open
                 if(fsUploadFile) {
-                    //close it
+                    //write what is still buffered and close it
+                    bool flushed = upload_writer.end();
                     fsUploadFile.close();
+                    if (!flushed) {
+                        web_interface->_upload_status=UPLOAD_STATUS_FAILED;
+                        ESPCOM::println (F ("Error ESP write"), PRINTER_PIPE);
+                        pushError(ESP_ERROR_FILE_WRITE, "File write failed");
+                    } else if ((crcargvalue.length() > 0) && (strtoul (crcargvalue.c_str(), NULL, 16) != upload_writer.crc32())) {
+                        web_interface->_upload_status=UPLOAD_STATUS_FAILED;
+                        ESPCOM::println (F ("Error ESP CRC"), PRINTER_PIPE);
+                        pushError(ESP_ERROR_FILE_WRITE, "File CRC mismatch");
+                    }
                     if (web_interface->_upload_status == UPLOAD_STATUS_ONGOING) {
                         web_interface->_upload_status = UPLOAD_STATUS_SUCCESSFUL;
+                        upload_crc32 = upload_writer.crc32();
                     }
                 } else {
                     //we have a problem set flag UPLOAD_STATUS_FAILED
@@ -710,10 +859,17 @@ void SPIFFSFileupload()
     }
     if (web_interface->_upload_status == UPLOAD_STATUS_FAILED) {
         cancelUpload();
+        upload_writer.abort();
+        if (fsUploadFile) {
+            fsUploadFile.close();
+        }
         if (SPIFFS.exists (filename) ) {
             SPIFFS.remove (filename);
             }
     }
+#ifdef STATE_PUSH_FEATURE
+    push_upload_state();
+#endif
     CONFIG::wait(0);
 }
 
@@ -813,7 +969,9 @@ void WebUpdateUpload()
         cancelUpload();
         Update.end();
     }
-    
+#ifdef STATE_PUSH_FEATURE
+    push_upload_state();
+#endif
     CONFIG::wait(0);
 }
 
@@ -922,6 +1080,44 @@ void handle_not_found()
     }
 }
 
+//web command answer is sent while printer answers come
+typedef struct {
+    WiFiClient client;
+    String buffer;
+    bool datasent;
+} web_query_context;
+
+static void web_query_line (const char * line, size_t len, void * context)
+{
+    (void)len;
+    web_query_context * query = (web_query_context *)context;
+    query->buffer += line;
+    query->buffer += "\n";
+    if (query->buffer.length() > 1200) {
+        query->client.write (query->buffer.c_str(), query->buffer.length());
+        log_esp3d("Sending %s", query->buffer.c_str());
+        query->buffer = "";
+        query->datasent = true;
+    }
+}
+
+static void web_query_done (query_status status, void * context)
+{
+    (void)status;
+    web_query_context * query = (web_query_context *)context;
+    if (query->buffer.length() > 0) {
+        query->client.write (query->buffer.c_str(), query->buffer.length());
+        log_esp3d("Sending %s", query->buffer.c_str());
+        query->datasent = true;
+    }
+    if (!query->datasent) {
+        query->client.print (" \r\n");
+    }
+    //to be sure connection close
+    query->client.stop();
+    delete query;
+}
+
 //Handle web command query and send answer /////////////////////////////
 void handle_web_command()
 {
@@ -930,7 +1126,6 @@ void handle_web_command()
           web_interface->web_server.send(403,"text/plain","Not allowed, log in first!\n");
           return;
       }*/
-    String buffer2send = "";
     ESPResponseStream espresponse;
     String cmd = "";
     if (web_interface->web_server.hasArg("plain") || web_interface->web_server.hasArg("commandText")) {
@@ -978,137 +1173,39 @@ void handle_web_command()
         }
         //send command to serial as no need to transfer ESP command
         //to avoid any pollution if Uploading file to SDCard
-        if ((web_interface->blockserial) == false) {
-            //block every query
-            web_interface->blockserial = true;
-            log_esp3d("Block Serial");
-            //empty the serial buffer and incoming data
-            log_esp3d("Start PurgeSerial");
-            if(ESPCOM::available(DEFAULT_PRINTER_PIPE)) {
-                ESPCOM::bridge();
-                CONFIG::wait(1);
-            }
-            log_esp3d("End PurgeSerial");
-            web_interface->web_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-            web_interface->web_server.sendHeader("Content-Type","text/plain",true);
-            web_interface->web_server.sendHeader("Cache-Control","no-cache");
-            web_interface->web_server.send(200);
-            //send command
-            log_esp3d("Start PurgeSerial");
-            if(ESPCOM::available(DEFAULT_PRINTER_PIPE)) {
-                ESPCOM::bridge();
-                CONFIG::wait(1);
-            }
-            log_esp3d("End PurgeSerial");
-            ESPCOM::println (cmd, DEFAULT_PRINTER_PIPE);
-            bool done = false;
-            String current_buffer;
-            String current_line;
-            //int pos;
-            int temp_counter = 0;
-            String tmp;
-            bool datasent = false;
-            uint32_t timeout = millis();
-            //pickup the list
-            while ((millis() - timeout < 2000) && !done) {
-                //give some time between each buffer
-                if (ESPCOM::available(DEFAULT_PRINTER_PIPE)) {
-                    log_esp3d("Got data");
-                    timeout = millis();
-                    size_t len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
-                    uint8_t sbuf[len+1];
-                    //read buffer
-                    ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, sbuf, len);
-                    //change buffer as string
-                    sbuf[len]='\0';
-                    //add buffer to current one if any
-                    current_buffer += (char * ) sbuf;
-                    while (current_buffer.indexOf("\n") !=-1) {
-                        log_esp3d("Remove new line");
-                        //remove the possible "\r"
-                        current_buffer.replace("\r","");
-                        //get line
-                        current_line = current_buffer.substring(0,current_buffer.indexOf("\n"));
-                        //if line is command ack - just exit so save the time out period
-                        if ((current_line == "ok") || (current_line == "wait") || (current_line.startsWith("ok") && !((CONFIG::GetFirmwareTarget() == REPETIER) || (CONFIG::GetFirmwareTarget() == REPETIER4DV)))) {
-                            done = true;
-                            buffer2send +=current_line;
-                            log_esp3d("Found ok/wait add New buffer %s", buffer2send.c_str());
-                            buffer2send +="\n";
-                            break;
-                        }
-                        //get the line and transmit it
-                        //check command
-                        if ((CONFIG::GetFirmwareTarget() == REPETIER) || (CONFIG::GetFirmwareTarget() == REPETIER4DV)) {
-                            //save time no need to continue
-                            if (current_line.indexOf("busy:") > -1) {
-                                temp_counter++;
-                            } else if (COMMAND::check_command(current_line, NO_PIPE, false)) {
-                                temp_counter ++ ;
-                            }
-                        } else {
-                            if (COMMAND::check_command(current_line, NO_PIPE, false)) {
-                                temp_counter ++ ;
-                            }
-                        }
-                        if (temp_counter > 5) {
-                            log_esp3d("Timeout X5");
-                            done = true;
-                            break;
-                        }
-                        if ((CONFIG::GetFirmwareTarget()  == REPETIER) || (CONFIG::GetFirmwareTarget() == REPETIER4DV)) {
-                            if (!current_line.startsWith( "ok ")) {
-                                buffer2send +=current_line;
-                                buffer2send +="\n";
-                            }
-                        } else {
-                            buffer2send +=current_line;
-                            log_esp3d("New buffer %s", buffer2send.c_str());
-                            buffer2send +="\n";
-                        }
-                        if (buffer2send.length() > 1200) {
-                            web_interface->web_server.sendContent(buffer2send);
-                           log_esp3d("Sending %s", buffer2send.c_str());
-                            buffer2send = "";
-                            datasent = true;
-                        }
-                        //current remove line from buffer
-                        tmp = current_buffer.substring(current_buffer.indexOf("\n")+1,current_buffer.length());
-                        current_buffer = tmp;
-                        CONFIG::wait (0);
-                    }
-                    CONFIG::wait (0);
-                } else {
-                    CONFIG::wait(1);
-                }
-                //it is sending too many temp status should be heating so let's exit the loop
-                if (temp_counter > 5) {
-                    done = true;
-                }
-            }
-            log_esp3d("Finished");
-            //to be sure connection close
-            if (buffer2send.length() > 0) {
-                web_interface->web_server.sendContent(buffer2send);
-                log_esp3d("Sending %s", buffer2send.c_str());
-                datasent = true;
-            }
-            if (!datasent) {
-                web_interface->web_server.sendContent(" \r\n");
+        //other web commands just wait their turn in queue
+        if (!web_interface->blockserial) {
+            web_query_context * query = new web_query_context;
+            if (query && serial_query.queue(cmd, web_query_line, web_query_done, query)) {
+                //answer is sent by callbacks, keep connection for them
+                query->client = web_interface->web_server.client();
+                query->datasent = false;
+                query->client.print (F("HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n"));
+                return;
             }
-            web_interface->web_server.sendContent("");
-            log_esp3d("Start PurgeSerial");
-            if(ESPCOM::available(DEFAULT_PRINTER_PIPE)) {
-                ESPCOM::bridge();
-                CONFIG::wait(1);
+            if (query) {
+                delete query;
             }
-            log_esp3d("End PurgeSerial");
-            web_interface->blockserial = false;
-            log_esp3d("Release PurgeSerial");
-        } else {
-            web_interface->web_server.send(200,"text/plain","Serial is busy, retry later!");
         }
+        web_interface->web_server.send(200,"text/plain","Serial is busy, retry later!");
+    }
+}
+
+//Runtime metrics in Prometheus text format ///////////////////////////
+void handle_metrics()
+{
+    if (web_interface->is_authenticated() == LEVEL_GUEST) {
+        web_interface->web_server.send(401,"text/plain","Authentication failed!\n");
+        return;
     }
+    ESPResponseStream espresponse;
+    web_interface->web_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    web_interface->web_server.sendHeader("Content-Type","text/plain; version=0.0.4");
+    web_interface->web_server.sendHeader("Cache-Control","no-cache");
+    web_interface->web_server.send(200);
+    espresponse.header_sent = true;
+    Metrics::print (WEB_PIPE, &espresponse);
+    ESPCOM::flush (WEB_PIPE, &espresponse);
 }
 
 //Handle web command query and sent ack or fail instead of answer //////
@@ -1162,7 +1259,7 @@ void handle_web_command_silent()
     } else {
         //send command to serial as no need to transfer ESP command
         //to avoid any pollution if Uploading file to SDCard
-        if ((web_interface->blockserial) == false) {
+        if (!web_interface->blockserial && !serial_query.active()) {
             //send command
             ESPCOM::println (cmd, DEFAULT_PRINTER_PIPE);
             web_interface->web_server.send(200,"text/plain","ok");
@@ -1202,6 +1299,26 @@ void handle_serial_SDFileList()
 
 #define NB_RETRY 5
 #define MAX_RESEND_BUFFER 228
+
+#ifndef USE_AS_UPDATER_ONLY
+#ifdef GCODE_MINIFIER_FEATURE
+static GcodeMinifier upload_minifier;
+#endif
+
+//queue line of uploaded file, compacted if possible
+static bool push_upload_line(const String & line)
+{
+#ifdef GCODE_MINIFIER_FEATURE
+    char compact[MAX_RESEND_BUFFER + 1];
+    if (upload_minifier.minify(line.c_str(), line.length(), compact) == 0) {
+        return true;
+    }
+    return gcode_streamer.push (compact);
+#else
+    return gcode_streamer.push (line.c_str());
+#endif
+}
+#endif //USE_AS_UPDATER_ONLY
 #define SERIAL_CHECK_TIMEOUT 2000
 //SD file upload by serial
 void SDFile_serial_upload()
@@ -1211,6 +1328,7 @@ void SDFile_serial_upload()
     static String current_line;
     static bool is_comment = false;
     static String current_filename;
+    static uint32_t upload_start = 0;
     String response;
     //Guest cannot upload - only admin and user
     if(web_interface->is_authenticated() == LEVEL_GUEST) {
@@ -1276,12 +1394,27 @@ void SDFile_serial_upload()
                         //besure nothing left again
                         purge_serial();
                         command = "M28 " + upload.filename;
+#ifdef BINARY_TRANSFER_FEATURE
+                        //file is sent by packets if printer supports it
+                        if (binary_transfer.supported() && binary_transfer.begin(upload.filename.c_str())) {
+                            //no numbered line has been sent since reset
+                            lineNb = 0;
+                            upload_start = millis();
+                            log_esp3d("Binary creation Ok");
+                        } else
+#endif
                         //send start upload
                         //no correction allowed because it means reset numbering was failed
                         if (sendLine2Serial(command, lineNb, NULL)){
                             CONFIG::wait(1200);
                             //additional purge, in case it is slow to answer
                             purge_serial();
+                            //file lines are streamed from now
+                            gcode_streamer.begin(lineNb + 1);
+#ifdef GCODE_MINIFIER_FEATURE
+                            upload_minifier.begin(CONFIG::GetFirmwareTarget());
+#endif
+                            upload_start = millis();
                             web_interface->_upload_status= UPLOAD_STATUS_ONGOING;
                             log_esp3d("Creation Ok");
                             
@@ -1295,6 +1428,15 @@ void SDFile_serial_upload()
                 //Upload write
                 //**************
                 //upload is on going with data coming by 2K blocks
+#ifdef BINARY_TRANSFER_FEATURE
+            } else if ((upload.status == UPLOAD_FILE_WRITE) && binary_transfer.started()) {
+                //file is copied as it is, comments included
+                if (!binary_transfer.write(upload.buf, upload.currentSize)) {
+                    log_esp3d("Error sending block");
+                    web_interface->_upload_status= UPLOAD_STATUS_FAILED;
+                    pushError(ESP_ERROR_FILE_WRITE, "File write failed");
+                }
+#endif
             } else if(upload.status == UPLOAD_FILE_WRITE) { //if com error no need to send more data to serial
                 for (uint pos = 0;( pos < upload.currentSize) && (web_interface->_upload_status == UPLOAD_STATUS_ONGOING); pos++) { //parse full post data
                     //feed watchdog
@@ -1312,10 +1454,9 @@ void SDFile_serial_upload()
                         if (current_line.length() < MAX_RESEND_BUFFER) {
                             //do we have something in buffer ?
                             if (current_line.length() > 0 ) {
-                                lineNb++;
-                                if (!sendLine2Serial (current_line, lineNb, NULL) ) {
+                                //wait only if printer buffer is full
+                                if (!push_upload_line (current_line) ) {
                                     log_esp3d("Error sending line");
-                                    CloseSerialUpload (true, current_filename,lineNb);
                                     web_interface->_upload_status= UPLOAD_STATUS_FAILED;
                                     pushError(ESP_ERROR_FILE_WRITE, "File write failed");
                                 }
@@ -1345,21 +1486,42 @@ void SDFile_serial_upload()
                 }
                 //Upload end
                 //**************
+#ifdef BINARY_TRANSFER_FEATURE
+            } else if(upload.status == UPLOAD_FILE_END && web_interface->_upload_status == UPLOAD_STATUS_ONGOING && binary_transfer.started()) {
+                if (binary_transfer.end()) {
+                    log_esp3d ("Upload finished: %d bytes in %d ms", binary_transfer.bytesSent(), millis() - upload_start);
+                    //file is already closed, M29 just ends upload
+                    CloseSerialUpload (false, current_filename, 1);
+                } else {
+                    log_esp3d ("Error closing file");
+                    web_interface->_upload_status= UPLOAD_STATUS_FAILED;
+                    pushError(ESP_ERROR_FILE_CLOSE, "File close failed");
+                }
+#endif
             } else if(upload.status == UPLOAD_FILE_END && web_interface->_upload_status == UPLOAD_STATUS_ONGOING) {
                 //if last part does not have '\n'
                 if (current_line.length()  > 0) {
-                    lineNb++;
-                    if (!sendLine2Serial (current_line, lineNb, NULL) ) {
+                    if (!push_upload_line (current_line) ) {
                         log_esp3d ("Error sending buffer");
-                        lineNb++;
-                        CloseSerialUpload (true, current_filename, lineNb);
                         web_interface->_upload_status= UPLOAD_STATUS_FAILED;
                         pushError(ESP_ERROR_FILE_WRITE, "File write failed");
                     }
                 }
-                log_esp3d ("Upload finished");
-                lineNb++;
-                CloseSerialUpload (false, current_filename, lineNb);
+                //all lines must be acknowledged before closing file
+                if ((web_interface->_upload_status == UPLOAD_STATUS_ONGOING) && !gcode_streamer.drain()) {
+                    log_esp3d ("Error sending buffer");
+                    web_interface->_upload_status= UPLOAD_STATUS_FAILED;
+                    pushError(ESP_ERROR_FILE_WRITE, "File write failed");
+                }
+                if (web_interface->_upload_status == UPLOAD_STATUS_ONGOING) {
+                    log_esp3d ("Upload finished: %d lines in %d ms", gcode_streamer.linesSent(), millis() - upload_start);
+#ifdef GCODE_MINIFIER_FEATURE
+                    log_esp3d ("Minified %d bytes to %d bytes", upload_minifier.bytesIn(), upload_minifier.bytesOut());
+#endif
+                    lineNb = gcode_streamer.nextLineNumber();
+                    gcode_streamer.end();
+                    CloseSerialUpload (false, current_filename, lineNb);
+                }
                 //Upload cancelled
                 //**************
             } else { //UPLOAD_FILE_ABORTED
@@ -1372,10 +1534,23 @@ void SDFile_serial_upload()
     
     if (web_interface->_upload_status == UPLOAD_STATUS_FAILED) {
         ESPCOM::println (F ("Upload failed"), PRINTER_PIPE);
+        if (gcode_streamer.started()) {
+            lineNb = gcode_streamer.nextLineNumber() - 1;
+            gcode_streamer.end();
+        }
+#ifdef BINARY_TRANSFER_FEATURE
+        if (binary_transfer.started()) {
+            binary_transfer.abort();
+            lineNb = 0;
+        }
+#endif
         lineNb++;
         CloseSerialUpload (true, current_filename, lineNb);
         cancelUpload();
     }
+#ifdef STATE_PUSH_FEATURE
+    push_upload_state();
+#endif
 #endif //USE_AS_UPDATER_ONLY
 }
 
@@ -24,6 +24,61 @@
 #define NODEBUG_WEBSOCKETS
 #include <WebSocketsServer.h>
 
+//WebSocketsServer which tells if a client can take a frame without waiting
+class ESP3DWebSocketsServer : public WebSocketsServer
+{
+public:
+    ESP3DWebSocketsServer (uint16_t port) : WebSocketsServer (port) {};
+    //Cookie header of client handshake, slot is emptied when read
+    String takeCookie (uint8_t num)
+    {
+        String value;
+        if (num < WEBSOCKETS_SERVER_CLIENT_MAX) {
+            value = _cookies[num];
+            _cookies[num] = "";
+        }
+        return value;
+    };
+    bool isConnected (uint8_t num)
+    {
+        return (num < WEBSOCKETS_SERVER_CLIENT_MAX) && clientIsConnected (&_clients[num]);
+    };
+    //room in tcp send buffer, only known on ESP8266
+    size_t availableForWrite (uint8_t num)
+    {
+        if (!isConnected (num)) {
+            return 0;
+        }
+#ifdef ARDUINO_ARCH_ESP8266
+        return _clients[num].tcp->availableForWrite();
+#else
+        return 0xFFFF;
+#endif
+    };
+protected:
+    bool execHttpHeaderValidation (String headerName, String headerValue)
+    {
+        if (headerName.equalsIgnoreCase ("Cookie")) {
+            //header gives no client, so only keep it if one handshake is running
+            //if several are interleaved it is dropped and client stays guest
+            uint8_t num = WEBSOCKETS_SERVER_CLIENT_MAX;
+            uint8_t count = 0;
+            for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+                if (_clients[i].tcp && (_clients[i].status == WSC_HEADER)) {
+                    num = i;
+                    count++;
+                }
+            }
+            if (count == 1) {
+                _cookies[num] = headerValue;
+            }
+        }
+        return true;
+    };
+private:
+    String _cookies[WEBSOCKETS_SERVER_CLIENT_MAX];
+};
+
 extern void handle_web_interface_root();
 extern void handle_login();
 extern void handleFileList();
@@ -31,9 +86,10 @@ extern void SPIFFSFileupload();
 extern void handle_not_found();
 extern void handle_web_command();
 extern void handle_web_command_silent();
+extern void handle_metrics();
 extern void handle_serial_SDFileList();
 extern void SDFile_serial_upload();
-extern WebSocketsServer * socket_server;
+extern ESP3DWebSocketsServer * socket_server;
 extern void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length);
 
 #ifdef SSDP_FEATURE
@@ -0,0 +1,82 @@
+/*
+  uart_fanout.cpp - ESP3D shared buffers for printer output
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "uart_fanout.h"
+#include "metrics.h"
+
+uart_chunk UartFanout::_pool[UART_POOL_CHUNKS];
+fanout_counter UartFanout::_counters[FANOUT_CONSUMERS];
+
+//get a free chunk with one reference, NULL if none
+uart_chunk * UartFanout::acquire()
+{
+    for (uint8_t i = 0; i < UART_POOL_CHUNKS; i++) {
+        if (_pool[i].refcount == 0) {
+            _pool[i].refcount = 1;
+            _pool[i].size = 0;
+            Metrics::setMax (METRIC_UART_POOL_HIGH, UART_POOL_CHUNKS - freeChunks());
+            return &_pool[i];
+        }
+    }
+    return NULL;
+}
+
+void UartFanout::retain (uart_chunk * chunk)
+{
+    if (chunk) {
+        chunk->refcount++;
+    }
+}
+
+void UartFanout::release (uart_chunk * chunk)
+{
+    if (chunk && (chunk->refcount > 0)) {
+        chunk->refcount--;
+    }
+}
+
+uint8_t UartFanout::freeChunks()
+{
+    uint8_t nb = 0;
+    for (uint8_t i = 0; i < UART_POOL_CHUNKS; i++) {
+        if (_pool[i].refcount == 0) {
+            nb++;
+        }
+    }
+    return nb;
+}
+
+void UartFanout::count (uint8_t consumer, size_t forwarded, size_t dropped)
+{
+    if (consumer >= FANOUT_CONSUMERS) {
+        return;
+    }
+    _counters[consumer].forwarded += forwarded;
+    _counters[consumer].dropped += dropped;
+}
+
+const fanout_counter & UartFanout::counter (uint8_t consumer)
+{
+    if (consumer >= FANOUT_CONSUMERS) {
+        consumer = FANOUT_PARSER;
+    }
+    return _counters[consumer];
+}
@@ -0,0 +1,70 @@
+/*
+  uart_fanout.h - ESP3D shared buffers for printer output
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _UART_FANOUT_H
+#define _UART_FANOUT_H
+#include <Arduino.h>
+#include "config.h"
+
+#define UART_POOL_CHUNKS 6
+#define UART_POOL_CHUNK_SIZE 256
+
+//consumers of printer output
+typedef enum {
+    FANOUT_PARSER = 0,
+    FANOUT_WEBSOCKET = 1,
+    FANOUT_TCP = 2, //one per data port client
+} fanout_consumer;
+
+#ifdef TCP_IP_DATA_FEATURE
+#define FANOUT_CONSUMERS (FANOUT_TCP + MAX_SRV_CLIENTS)
+#else
+#define FANOUT_CONSUMERS FANOUT_TCP
+#endif
+
+typedef struct {
+    uint8_t refcount;
+    uint16_t size;
+    uint8_t data[UART_POOL_CHUNK_SIZE];
+} uart_chunk;
+
+typedef struct {
+    uint32_t forwarded;
+    uint32_t dropped;
+} fanout_counter;
+
+//UART data is read once in a chunk of the pool and each consumer
+//keeps a reference on it until it is done, chunk is free when no
+//reference is left
+class UartFanout
+{
+public:
+    static uart_chunk * acquire();
+    static void retain (uart_chunk * chunk);
+    static void release (uart_chunk * chunk);
+    static uint8_t freeChunks();
+    static void count (uint8_t consumer, size_t forwarded, size_t dropped = 0);
+    static const fanout_counter & counter (uint8_t consumer);
+private:
+    static uart_chunk _pool[UART_POOL_CHUNKS];
+    static fanout_counter _counters[FANOUT_CONSUMERS];
+};
+
+#endif //_UART_FANOUT_H
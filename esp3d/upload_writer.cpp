@@ -0,0 +1,139 @@
+/*
+  upload_writer.cpp - ESP3D buffered file upload class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include "upload_writer.h"
+#include "metrics.h"
+
+//CRC32 (IEEE) by nibble, small table to save flash and RAM
+const uint32_t crc32_table[] PROGMEM = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t * data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ pgm_read_dword(&crc32_table[crc & 0x0F]);
+        crc = (crc >> 4) ^ pgm_read_dword(&crc32_table[crc & 0x0F]);
+    }
+    return crc;
+}
+
+UploadWriter::UploadWriter()
+{
+    _file = NULL;
+    _buffer = NULL;
+    _buffer_size = 0;
+    _crc = 0xFFFFFFFF;
+    _total = 0;
+}
+
+UploadWriter::~UploadWriter()
+{
+    abort();
+}
+
+//file must be open for writing, buffer only lives during upload
+bool UploadWriter::begin(FS_FILE * file)
+{
+    abort();
+    _buffer = (uint8_t *)malloc(UPLOAD_WRITER_BUFFER_SIZE);
+    if (!_buffer) {
+        return false;
+    }
+    _file = file;
+    _buffer_size = 0;
+    _crc = 0xFFFFFFFF;
+    _total = 0;
+    return true;
+}
+
+bool UploadWriter::flush()
+{
+    if (_buffer_size == 0) {
+        return true;
+    }
+    uint32_t start = micros();
+    size_t written = _file->write(_buffer, _buffer_size);
+    Metrics::observe (METRIC_FLASH_WRITE_TIME, micros() - start);
+    bool res = (written == _buffer_size);
+    _buffer_size = 0;
+    return res;
+}
+
+bool UploadWriter::write(const uint8_t * data, size_t len)
+{
+    if (!_buffer || !_file) {
+        return false;
+    }
+    _crc = crc32_update(_crc, data, len);
+    _total += len;
+    while (len > 0) {
+        size_t chunk = UPLOAD_WRITER_BUFFER_SIZE - _buffer_size;
+        if (chunk > len) {
+            chunk = len;
+        }
+        //full buffer is written directly from data without copy
+        if ((_buffer_size == 0) && (chunk == UPLOAD_WRITER_BUFFER_SIZE)) {
+            uint32_t start = micros();
+            size_t written = _file->write(data, chunk);
+            Metrics::observe (METRIC_FLASH_WRITE_TIME, micros() - start);
+            if (written != chunk) {
+                return false;
+            }
+        } else {
+            memcpy(&_buffer[_buffer_size], data, chunk);
+            _buffer_size += chunk;
+            if ((_buffer_size == UPLOAD_WRITER_BUFFER_SIZE) && !flush()) {
+                return false;
+            }
+        }
+        data += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+//write what is left, file is not closed here
+bool UploadWriter::end()
+{
+    if (!_buffer || !_file) {
+        return false;
+    }
+    bool res = flush();
+    free(_buffer);
+    _buffer = NULL;
+    _file = NULL;
+    return res;
+}
+
+void UploadWriter::abort()
+{
+    if (_buffer) {
+        free(_buffer);
+        _buffer = NULL;
+    }
+    _buffer_size = 0;
+    _file = NULL;
+}
@@ -0,0 +1,57 @@
+/*
+  upload_writer.h - ESP3D buffered file upload class
+
+  Copyright (c) 2014 Luc Lebosse. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _UPLOAD_WRITER_H
+#define _UPLOAD_WRITER_H
+#include <Arduino.h>
+#include "config.h"
+
+//multiple of SPIFFS page size (256), so every write starts on a page
+#define UPLOAD_WRITER_BUFFER_SIZE 2048
+
+//Gather upload chunks of any size and write file by full buffers,
+//a CRC32 of whole data is computed on the way
+class UploadWriter
+{
+public:
+    UploadWriter();
+    ~UploadWriter();
+    bool begin(FS_FILE * file);
+    bool write(const uint8_t * data, size_t len);
+    bool end();
+    void abort();
+    uint32_t crc32()
+    {
+        return ~_crc;
+    };
+    uint32_t size()
+    {
+        return _total;
+    };
+private:
+    FS_FILE * _file;
+    uint8_t * _buffer;
+    size_t _buffer_size;
+    uint32_t _crc;
+    uint32_t _total;
+    bool flush();
+};
+
+#endif //_UPLOAD_WRITER_H
@@ -54,6 +54,9 @@
 #include "GenLinkedList.h"
 #include "command.h"
 #include "espcom.h"
+#include "response_classifier.h"
+#include "metrics.h"
+#include "line_framer.h"
 
 #ifdef SSDP_FEATURE
 #ifdef ARDUINO_ARCH_ESP32
@@ -84,35 +87,36 @@ uint8_t Checksum(const char * line, uint16_t lineSize)
     return checksum_val;
 }
 
-String CheckSumLine(const char* line, uint32_t linenb)
-{
-    String linechecksum = "N" + String(linenb)+ " " + line;
-    uint8_t crc = Checksum(linechecksum.c_str(), linechecksum.length());
-    linechecksum+="*"+String(crc);
-    return linechecksum;
-}
+//printer answers lines when uploading
+static LineAssembler printer_answer;
 
 bool purge_serial()
 {
     uint32_t start = millis();
-    uint8_t buf [51];
+    uint8_t buf [50];
+    response_info response;
     ESPCOM::flush (DEFAULT_PRINTER_PIPE);
     CONFIG::wait (5);
     log_esp3d("Purge Serial");
+    printer_answer.reset();
     while (ESPCOM::available(DEFAULT_PRINTER_PIPE) > 0 ) {
         if ((millis() - start ) > 2000) {
             log_esp3d("Purge timeout");
             return false;
         }
-        size_t len = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, buf, 50);
-        buf[len] = '\0';
-        if ( ( CONFIG::GetFirmwareTarget() == REPETIER4DV) || (CONFIG::GetFirmwareTarget() == REPETIER) ) {
-            String s = (const char *)buf;
-            //repetier never stop sending data so no need to wait if have 'wait' or 'busy'
-            if((s.indexOf ("wait") > -1) || (s.indexOf ("busy") > -1)) {
-                return true;
+        size_t len = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, buf, sizeof(buf));
+        uint8_t * p = buf;
+        while (len > 0) {
+            size_t used = printer_answer.feed (p, len);
+            p += used;
+            len -= used;
+            if (printer_answer.ready()) {
+                ResponseClassifier::classify (printer_answer.line(), printer_answer.length(), response);
+                //repetier never stop sending data so no need to wait if have 'wait' or 'busy'
+                if ((response.type == RESPONSE_WAIT) || (response.type == RESPONSE_BUSY)) {
+                    return true;
+                }
             }
-            log_esp3d("Purge interrupted");
         }
         CONFIG::wait (5);
     }
@@ -130,128 +134,122 @@ size_t wait_for_data(uint32_t timeout)
     return ESPCOM::available(DEFAULT_PRINTER_PIPE);
 }
 
-uint32_t Get_lineNumber(String & response)
+//return -1 if line is not a resend request
+int32_t Get_lineNumber(const char * line, size_t len)
 {
-    int32_t l = 0;
-    String sresend = "Resend:";
-    if ( CONFIG::GetFirmwareTarget() == SMOOTHIEWARE) {
-        sresend = "rs N";
-    }
-    int pos = response.indexOf(sresend);
-    if (pos == -1 ) {
+    response_info response;
+    ResponseClassifier::classify (line, len, response);
+    if (response.type != RESPONSE_RESEND) {
         return -1;
     }
-    pos+=sresend.length();
-    int pos2 = response.indexOf("\n", pos);
-    String snum = response.substring(pos, pos2);
-    //remove potential unwished char
-    snum.replace("\r", "");
-    l = snum.toInt();
-    log_esp3d("Line requested is %d", l);
-    return l;
+    log_esp3d("Line requested is %d", response.number);
+    return response.number;
 }
 
 //function to send line to serial///////////////////////////////////////
 //if newlinenb is NULL no auto correction of line number in case of resend
 bool sendLine2Serial (String &  line, int32_t linenb,  int32_t * newlinenb)
 {
-    log_esp3d ("Send line %d");
-    String line2send;
-    String sok = "ok";
-    String sresend = "Resend:";
+    log_esp3d ("Send line %d", linenb);
+    char line2send[LINE_FRAMER_SIZE];
+    response_info response;
     if (newlinenb) {
         *newlinenb = linenb;
     }
-    if ( CONFIG::GetFirmwareTarget() == SMOOTHIEWARE) {
-        sresend = "rs N";
-    }
 #ifdef DISABLE_SERIAL_CHECKSUM
     linenb = -1;
 #endif
-    if (linenb != -1) {
-        if ( ( CONFIG::GetFirmwareTarget() == REPETIER4DV) || (CONFIG::GetFirmwareTarget() == REPETIER) ) {
-            sok+=" " + String(linenb);
-        }
-        line2send = CheckSumLine(line.c_str(),linenb);
-    } else {
-        line2send = line;
+    if (LineFramer::frame (line2send, sizeof(line2send), line.c_str(), line.length(), linenb) == 0) {
+        log_esp3d ("Line too long");
+        return false;
     }
     //purge serial as nothing is supposed to interfere with upload
     purge_serial();
     //send line
-    ESPCOM::println (line2send, DEFAULT_PRINTER_PIPE);
+    ESPCOM::print (line2send, DEFAULT_PRINTER_PIPE);
     ESPCOM::flush(DEFAULT_PRINTER_PIPE);
     //check answer
     if (wait_for_data(2000) > 0 ) {
         bool done = false;
         uint32_t timeout = millis();
         uint8_t count = 0;
+        size_t received = 0;
+        uint8_t sbuf[64];
         //got data check content
-        String response ;
+        printer_answer.reset();
         while (!done) {
             size_t len = ESPCOM::available(DEFAULT_PRINTER_PIPE);
             //get size of buffer
             if (len > 0) {
-                uint8_t * sbuf = (uint8_t *)malloc(len+1);
-                if(!sbuf) {
-                    return false;
+                if (len > sizeof(sbuf)) {
+                    len = sizeof(sbuf);
                 }
                 //read buffer
-                ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, sbuf, len);
-                //convert buffer to zero end array
-                sbuf[len] = '\0';
-                //use string because easier to handle and allow to re-assemble cutted answer
-                response += (const char*) sbuf;
-                //in that case there is no way to know what is the right number to use and so send should be failed
-                if (( ( CONFIG::GetFirmwareTarget() == REPETIER4DV) || (CONFIG::GetFirmwareTarget() == REPETIER) ) && (response.indexOf ("skip") != -1)) {
-                    log_esp3d ("Wrong line requested");
-                    count = 5;
-                }
-                //it is resend ?
-                int pos = response.indexOf (sresend);
-                //be sure we get full line to be able to process properly
-                if (( pos > -1) && (response.lastIndexOf("\n") > pos)) {
-                    log_esp3d ("Resend detected");
-                    uint32_t line_number = Get_lineNumber(response);
-                    //this part is only if have newlinenb variable
-                    if (newlinenb != nullptr) {
-                        *newlinenb = line_number;
-                        free(sbuf);
-                        //no need newlinenb in this one in theory, but just in case...
-                        return sendLine2Serial (line, line_number, newlinenb);
-                    } else {
-                        //the line requested is not the current one so we stop
-                        if (line_number !=(uint32_t)linenb) {
-                            log_esp3d ("Wrong line requested");
-                            count = 5;
-                        }
-                    }
-                    count++;
-                    if (count > 5) {
-                        free(sbuf);
-                        log_esp3d ("Exit too many resend or wrong line");
-                        return false;
+                len = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, sbuf, len);
+                received += len;
+                uint8_t * p = sbuf;
+                //lines can be cut between buffers, assembler put them back together
+                while (len > 0) {
+                    size_t used = printer_answer.feed (p, len);
+                    p += used;
+                    len -= used;
+                    if (!printer_answer.ready()) {
+                        continue;
                     }
-                    purge_serial();
-                    log_esp3d ("Resend x%d", count);
-                    response="";
-                    ESPCOM::println (line2send, DEFAULT_PRINTER_PIPE);
-                    ESPCOM::flush (DEFAULT_PRINTER_PIPE);
-                    wait_for_data(1000);
-                    timeout = millis();
-
-                } else {
-                    if ( (response.indexOf (sok) > -1) ) { //we have ok so it is done
-                        free(sbuf);
+                    ResponseClassifier::classify (printer_answer.line(), printer_answer.length(), response);
+                    //in that case there is no way to know what is the right number to use and so send should be failed
+                    if (response.type == RESPONSE_SKIP) {
+                        log_esp3d ("Wrong line requested");
+                        count = 5;
+                    } else if (response.type == RESPONSE_RESEND) {
+                        log_esp3d ("Resend detected");
+                        Metrics::add (METRIC_RESENDS);
+                        int32_t line_number = Get_lineNumber (printer_answer.line(), printer_answer.length());
+                        //this part is only if have newlinenb variable
+                        if ((newlinenb != nullptr) && (line_number != -1)) {
+                            *newlinenb = line_number;
+                            //send line again with number requested, an unnumbered line gets it too
+#ifndef DISABLE_SERIAL_CHECKSUM
+                            if (line_number != linenb) {
+                                linenb = line_number;
+                                if (LineFramer::frame (line2send, sizeof(line2send), line.c_str(), line.length(), linenb) == 0) {
+                                    log_esp3d ("Line too long");
+                                    return false;
+                                }
+                            }
+#endif
+                        } else {
+                            //the line requested is not the current one so we stop
+                            if (line_number != linenb) {
+                                log_esp3d ("Wrong line requested");
+                                count = 5;
+                            }
+                        }
+                        count++;
+                        if (count > 5) {
+                            log_esp3d ("Exit too many resend or wrong line");
+                            return false;
+                        }
+                        purge_serial();
+                        log_esp3d ("Resend x%d", count);
+                        //forget what is left of previous answer
+                        len = 0;
+                        received = 0;
+                        ESPCOM::print (line2send, DEFAULT_PRINTER_PIPE);
+                        ESPCOM::flush (DEFAULT_PRINTER_PIPE);
+                        wait_for_data(1000);
+                        timeout = millis();
+                    } else if ((response.type == RESPONSE_ACK) &&
+                               ((linenb == -1) || !ResponseClassifier::ackHasLineNumber() || (response.number == linenb))) {
+                        //we have ok so it is done
                         log_esp3d ("Got ok");
                         purge_serial();
                         return true;
                     }
                 }
-                free(sbuf);
             }
             //no answer or over buffer  exit
-            if ( (millis() - timeout > 2000) ||  (response.length() >200)) {
+            if ( (millis() - timeout > 2000) ||  (received > 200)) {
                 log_esp3d("Time out");
                 done = true;
             }
@@ -355,6 +353,10 @@ WEBINTERFACE_CLASS::WEBINTERFACE_CLASS (int port) : web_server (port)
     //web commands
     web_server.on ("/command", HTTP_ANY, handle_web_command);
     web_server.on ("/command_silent", HTTP_ANY, handle_web_command_silent);
+#if !defined(ASYNCWEBSERVER)
+    //runtime metrics
+    web_server.on ("/metrics", HTTP_GET, handle_metrics);
+#endif
     //Serial SD management
     web_server.on ("/upload_serial", HTTP_ANY, handle_serial_SDFileList, SDFile_serial_upload);
 
@@ -379,18 +381,29 @@ level_authenticate_type  WEBINTERFACE_CLASS::is_authenticated()
 {
 #ifdef AUTHENTICATION_FEATURE
     if (web_server.hasHeader ("Cookie") ) {
-        String cookie = web_server.header ("Cookie");
-        int pos = cookie.indexOf ("ESPSESSIONID=");
-        if (pos != -1) {
-            int pos2 = cookie.indexOf (";", pos);
-            String sessionID = cookie.substring (pos + strlen ("ESPSESSIONID="), pos2);
-            IPAddress ip = web_server.client().remoteIP();
-            //check if cookie can be reset and clean table in same time
-            return ResetAuthIP (ip, sessionID.c_str() );
-        }
+        return is_authenticated (web_server.header ("Cookie"), web_server.client().remoteIP());
+    }
+    return LEVEL_GUEST;
+#else
+    return LEVEL_ADMIN;
+#endif
+}
+
+//same check for a cookie not coming from web server (websocket handshake)
+level_authenticate_type  WEBINTERFACE_CLASS::is_authenticated (const String & cookie, IPAddress ip)
+{
+#ifdef AUTHENTICATION_FEATURE
+    int pos = cookie.indexOf ("ESPSESSIONID=");
+    if (pos != -1) {
+        int pos2 = cookie.indexOf (";", pos);
+        String sessionID = cookie.substring (pos + strlen ("ESPSESSIONID="), pos2);
+        //check if cookie can be reset and clean table in same time
+        return ResetAuthIP (ip, sessionID.c_str() );
     }
     return LEVEL_GUEST;
 #else
+    (void)cookie;
+    (void)ip;
     return LEVEL_ADMIN;
 #endif
 }
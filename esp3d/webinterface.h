@@ -77,6 +77,7 @@ public:
     bool restartmodule;
     String getContentType (String filename);
     level_authenticate_type is_authenticated();
+    level_authenticate_type is_authenticated (const String & cookie, IPAddress ip);
     bool AddAuthIP (auth_ip * item);
     bool blockserial;
 #ifdef AUTHENTICATION_FEATURE
@@ -605,7 +605,7 @@ bool WIFI_CONFIG::Enable_servers()
     data_server->setNoDelay (true);
 #endif
 #if !defined (ASYNCWEBSERVER)
-    socket_server = new WebSocketsServer (wifi_config.iweb_port+1);
+    socket_server = new ESP3DWebSocketsServer (wifi_config.iweb_port+1);
     socket_server->begin();
     socket_server->onEvent(webSocketEvent);
 #endif
@@ -0,0 +1,401 @@
+/*
+  bench.cpp - printer bridge benchmark against the fake printer
+
+  A fixed G-code corpus goes the way of a serial SD upload (comments cut,
+  minifier, numbered lines, MeatPack) to the fake printer, and the units
+  on that path are timed alone. Results are written as JSON and compared
+  with the committed baseline, a regression beyond threshold fails.
+
+  Stream results use simulated time and are the same on every host.
+  CPU results are ns per item divided by ns of a fixed calibration loop,
+  so they do not depend much on host speed but stay noisy: they get a
+  larger threshold.
+
+  bench [-o results.json] [-b baseline.json] [-w]
+  -w writes results as new baseline
+  BENCH_THRESHOLD (default 10) and BENCH_CPU_THRESHOLD (default 100) are
+  allowed regressions in percent
+*/
+
+#include <chrono>
+#include <vector>
+#include "test.h"
+#include "printer_sim.h"
+#include "espcom.h"
+#include "gcode_streamer.h"
+#include "line_assembler.h"
+#include "response_classifier.h"
+#include "line_framer.h"
+#include "gcode_minifier.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
+
+#define BENCH_CORPUS "data/bench.gcode"
+#define BENCH_BASELINE "data/bench_baseline.json"
+#define BENCH_RESULTS "build/bench.json"
+//line size limit of upload
+#define BENCH_LINE_SIZE 228
+//timed loops are run this many times and best one is kept
+#define BENCH_RUNS 5
+
+typedef enum {
+    HIGHER_IS_BETTER,
+    LOWER_IS_BETTER,
+} bench_direction;
+
+struct bench_result {
+    std::string name;
+    double value;
+    bench_direction direction;
+    //timed on host, so noisy
+    bool cpu;
+};
+
+static std::vector<bench_result> results;
+static std::vector<std::string> corpus;
+
+static void add_result(const char * name, double value, bench_direction direction, bool cpu)
+{
+    bench_result result = {name, value, direction, cpu};
+    results.push_back(result);
+}
+
+//lines as serial upload sends them: comment cut, empty lines skipped
+static bool load_corpus(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return false;
+    }
+    char buf[512];
+    while (fgets(buf, sizeof(buf), f)) {
+        char * comment = strchr(buf, ';');
+        if (comment) {
+            *comment = '\0';
+        }
+        std::string line(buf);
+        while (!line.empty() && ((line[line.size() - 1] == '\n') || (line[line.size() - 1] == '\r'))) {
+            line.erase(line.size() - 1);
+        }
+        if (!line.empty() && (line.size() < BENCH_LINE_SIZE)) {
+            corpus.push_back(line);
+        }
+    }
+    fclose(f);
+    return !corpus.empty();
+}
+
+static double now_ns()
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//keep compiler from removing timed work
+static volatile uint32_t bench_sink;
+
+//ns of a fixed integer loop, unit of CPU results
+static double calibration_ns()
+{
+    double best = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_ns();
+        uint32_t h = 2166136261u;
+        for (uint32_t i = 0; i < 1000000; i++) {
+            h = (h ^ (i & 0xFF)) * 16777619u;
+        }
+        bench_sink = h;
+        double t = now_ns() - start;
+        if ((run == 0) || (t < best)) {
+            best = t;
+        }
+    }
+    return best / 1000000;
+}
+
+//printer answers seen during an upload
+static const char * const answers[] = {
+    "ok",
+    "ok N1234 P15 B3",
+    " T:210.0 /210.0 B:60.0 /60.0 @:64 B@:127",
+    "ok T:210.0 /210.0 B:60.0 /60.0 @:64 B@:127",
+    "echo:busy: processing",
+    "Error:checksum mismatch, Last Line: 1233",
+    "Resend: 1234",
+    "X:10.00 Y:20.00 Z:0.30 E:0.00 Count X:800 Y:1600 Z:120",
+};
+#define NB_ANSWERS (sizeof(answers) / sizeof(answers[0]))
+
+static void bench_classifier(double unit)
+{
+    response_info response;
+    uint32_t acks = 0;
+    double best = 0;
+    ResponseClassifier::setFirmware(MARLIN);
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_ns();
+        for (int i = 0; i < 20000; i++) {
+            const char * line = answers[i % NB_ANSWERS];
+            ResponseClassifier::classify(line, strlen(line), response);
+            acks += (response.type == RESPONSE_ACK) ? 1 : 0;
+        }
+        double t = (now_ns() - start) / 20000;
+        if ((run == 0) || (t < best)) {
+            best = t;
+        }
+    }
+    bench_sink = acks;
+    add_result("cpu_classifier_per_line", best / unit, LOWER_IS_BETTER, true);
+}
+
+static void bench_framer(double unit)
+{
+    char buffer[LINE_FRAMER_SIZE];
+    size_t bytes = 0;
+    double best = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        double start = now_ns();
+        for (size_t i = 0; i < corpus.size(); i++) {
+            bytes += LineFramer::frame(buffer, sizeof(buffer), corpus[i].c_str(), corpus[i].size(), i + 1);
+        }
+        double t = (now_ns() - start) / corpus.size();
+        if ((run == 0) || (t < best)) {
+            best = t;
+        }
+    }
+    bench_sink = bytes;
+    add_result("cpu_framer_per_line", best / unit, LOWER_IS_BETTER, true);
+}
+
+static void bench_minifier(double unit)
+{
+    char out[GCODE_MINIFIER_LINE_SIZE];
+    GcodeMinifier minifier;
+    double best = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        minifier.begin(MARLIN);
+        double start = now_ns();
+        for (size_t i = 0; i < corpus.size(); i++) {
+            minifier.minify(corpus[i].c_str(), corpus[i].size(), out);
+        }
+        double t = (now_ns() - start) / corpus.size();
+        if ((run == 0) || (t < best)) {
+            best = t;
+        }
+    }
+    add_result("cpu_minifier_per_line", best / unit, LOWER_IS_BETTER, true);
+    add_result("minifier_bytes_ratio", (double)minifier.bytesOut() / minifier.bytesIn(), LOWER_IS_BETTER, false);
+}
+
+#ifdef MEATPACK_FEATURE
+static void bench_meatpack(double unit)
+{
+    uint8_t packed[64];
+    size_t in = 0;
+    size_t out = 0;
+    double best = 0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        in = 0;
+        out = 0;
+        double start = now_ns();
+        for (size_t i = 0; i < corpus.size(); i++) {
+            std::string line = corpus[i] + "\n";
+            size_t done = 0;
+            while (done < line.size()) {
+                size_t used;
+                out += MeatPack::encode((const uint8_t *)line.data() + done, line.size() - done, packed, sizeof(packed), used);
+                done += used;
+            }
+            in += line.size();
+        }
+        double t = (now_ns() - start) / in;
+        if ((run == 0) || (t < best)) {
+            best = t;
+        }
+    }
+    add_result("cpu_meatpack_per_byte", best / unit, LOWER_IS_BETTER, true);
+    add_result("meatpack_bytes_ratio", (double)out / in, LOWER_IS_BETTER, false);
+}
+
+//printer output goes to MeatPack as command.cpp does
+static void meatpack_answers()
+{
+    static LineAssembler assembler;
+    size_t pos = 0;
+    while (pos < host_printer_input.size()) {
+        pos += assembler.feed((const uint8_t *)host_printer_input.data() + pos, host_printer_input.size() - pos);
+        if (assembler.ready()) {
+            MeatPack::update(assembler.line(), assembler.length());
+        }
+    }
+    host_printer_input.clear();
+}
+#endif
+
+//whole corpus as a serial SD upload to a Marlin printer which gets a
+//corrupted line from time to time and reports temperatures
+static void bench_stream(const char * name, bool meatpack)
+{
+    host_reset();
+    CONFIG::SetFirmwareTarget(MARLIN);
+    printer_sim_config config = PrinterSim::defaults(MARLIN);
+    config.baud = 250000;
+    config.line_us = 1000;
+    config.corrupt_every = 200;
+    config.report_us = 1000000;
+    config.meatpack = meatpack;
+    PrinterSim::begin(config);
+#ifdef MEATPACK_FEATURE
+    for (int i = 0; meatpack && (i < 1000) && !MeatPack::active(); i++) {
+        MeatPack::poll();
+        meatpack_answers();
+        yield();
+    }
+    CHECK(MeatPack::active() == meatpack);
+#endif
+    uint32_t wire_start = PrinterSim::wireBytes();
+    uint64_t start = host_micros;
+    GcodeMinifier minifier;
+    minifier.begin(MARLIN);
+    char compact[BENCH_LINE_SIZE + 1];
+    CHECK(gcode_streamer.begin(1));
+    size_t lines = 0;
+    for (size_t i = 0; i < corpus.size(); i++) {
+        if (minifier.minify(corpus[i].c_str(), corpus[i].size(), compact) == 0) {
+            continue;
+        }
+        if (!gcode_streamer.push(compact)) {
+            break;
+        }
+        lines++;
+    }
+    CHECK(gcode_streamer.drain());
+    uint64_t time = host_micros - start;
+    CHECK(PrinterSim::done().size() == lines);
+    std::string prefix = name;
+    add_result((prefix + "_lines_per_s").c_str(), (lines * 1000000.0) / time, HIGHER_IS_BETTER, false);
+    add_result((prefix + "_wire_bytes").c_str(), PrinterSim::wireBytes() - wire_start, LOWER_IS_BETTER, false);
+    add_result((prefix + "_resends").c_str(), gcode_streamer.resendCount(), LOWER_IS_BETTER, false);
+    gcode_streamer.end();
+#ifdef MEATPACK_FEATURE
+    //printer restart ends packing
+    MeatPack::update("start", 5);
+#endif
+    PrinterSim::end();
+}
+
+static bool write_results(const char * path)
+{
+    FILE * f = fopen(path, "wb");
+    if (!f) {
+        printf("cannot write %s\n", path);
+        return false;
+    }
+    fprintf(f, "{\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        fprintf(f, "    \"%s\": %.6g%s\n", results[i].name.c_str(), results[i].value, (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(f, "}\n");
+    fclose(f);
+    return true;
+}
+
+//baseline is a flat object of "name": value
+static bool baseline_value(const std::string & baseline, const std::string & name, double & value)
+{
+    size_t p = baseline.find("\"" + name + "\"");
+    if (p == std::string::npos) {
+        return false;
+    }
+    p = baseline.find(':', p);
+    if (p == std::string::npos) {
+        return false;
+    }
+    value = atof(baseline.c_str() + p + 1);
+    return true;
+}
+
+static double threshold(const char * env, double value)
+{
+    const char * s = getenv(env);
+    return (s && *s) ? atof(s) : value;
+}
+
+static bool compare(const char * path)
+{
+    std::string baseline;
+    FILE * f = fopen(path, "rb");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return false;
+    }
+    char buf[512];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        baseline.append(buf, n);
+    }
+    fclose(f);
+    double sim_threshold = threshold("BENCH_THRESHOLD", 10) / 100;
+    double cpu_threshold = threshold("BENCH_CPU_THRESHOLD", 100) / 100;
+    bool ok = true;
+    for (size_t i = 0; i < results.size(); i++) {
+        const bench_result & r = results[i];
+        double base;
+        if (!baseline_value(baseline, r.name, base)) {
+            printf("%-32s %12.4g (not in baseline)\n", r.name.c_str(), r.value);
+            continue;
+        }
+        double change = (base != 0) ? ((r.value - base) / base) : 0;
+        //positive is worse
+        double loss = (r.direction == HIGHER_IS_BETTER) ? -change : change;
+        bool failed = loss > (r.cpu ? cpu_threshold : sim_threshold);
+        printf("%-32s %12.4g %12.4g %+7.1f%%%s\n", r.name.c_str(), r.value, base, change * 100, failed ? " REGRESSION" : "");
+        if (failed) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char ** argv)
+{
+    const char * results_path = BENCH_RESULTS;
+    const char * baseline_path = BENCH_BASELINE;
+    bool write_baseline = false;
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) {
+            results_path = argv[++i];
+        } else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) {
+            baseline_path = argv[++i];
+        } else if (strcmp(argv[i], "-w") == 0) {
+            write_baseline = true;
+        }
+    }
+    if (!load_corpus(BENCH_CORPUS)) {
+        return 1;
+    }
+    double unit = calibration_ns();
+    bench_stream("stream", false);
+#ifdef MEATPACK_FEATURE
+    bench_stream("stream_meatpack", true);
+#endif
+    bench_classifier(unit);
+    bench_framer(unit);
+    bench_minifier(unit);
+#ifdef MEATPACK_FEATURE
+    bench_meatpack(unit);
+#endif
+    if (test_failures) {
+        return test_result("bench");
+    }
+    if (write_baseline) {
+        return write_results(baseline_path) ? 0 : 1;
+    }
+    if (!write_results(results_path)) {
+        return 1;
+    }
+    bool ok = compare(baseline_path);
+    printf("bench: %s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,2044 @@
+; generated by slicer for ESP3D host benchmark
+;FLAVOR:Marlin
+;Layer height: 0.2
+M140 S60
+M104 S210
+M190 S60
+M109 S210
+G21 ; metric values
+G90 ; absolute positioning
+M82 ; extruder absolute
+G28 ; home all axes
+G92 E0
+G1 Z2.0 F3000
+G1 X0.1 Y20 Z0.3 F5000.0
+G1 X0.1 Y200.0 Z0.3 F1500.0 E15
+G1 X0.4 Y200.0 Z0.3 F5000.0
+G1 X0.4 Y20 Z0.3 F1500.0 E30
+G92 E0
+G1 Z2.0 F3000
+;LAYER:0
+G0 F9000 X89.519 Y101.769 Z0.200
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X124.957 Y101.039 E0.02393
+G1 X124.633 Y105.147 E0.04472
+G1 X123.672 Y109.153 E0.11497
+G1 X122.095 Y112.960 E0.15053
+G1 X119.942 Y116.473 E0.18459
+G1 X117.266 Y119.606 E0.26433
+G1 X114.133 Y122.282 E0.31255
+G1 X110.620 Y124.435 E0.38273
+G1 X106.813 Y126.011 E0.43131
+G1 X102.807 Y126.973 E0.48966
+G1 X98.700 Y127.296 E0.51870
+G1 X94.592 Y126.973 E0.57679
+G1 X90.586 Y126.011 E0.64887
+G1 X86.779 Y124.435 E0.70026
+G1 X83.266 Y122.282 E0.76474
+G1 X80.133 Y119.606 E0.82502
+G1 X77.457 Y116.473 E0.84886
+G1 X75.304 Y112.960 E0.91436
+G1 X73.727 Y109.153 E0.96982
+G1 X72.766 Y105.147 E1.00790
+G1 X72.442 Y101.039 E1.02976
+G1 X72.766 Y96.932 E1.10169
+G1 X73.727 Y92.925 E1.15006
+G1 X75.304 Y89.119 E1.21318
+G1 X77.457 Y85.606 E1.28591 ; segment
+G1 X80.133 Y82.473 E1.34876
+G1 X83.266 Y79.797 E1.42403
+G1 X86.779 Y77.644 E1.46773
+G1 X90.586 Y76.067 E1.53578
+G1 X94.592 Y75.105 E1.58246
+G1 X98.700 Y74.782 E1.65859
+G1 X102.807 Y75.105 E1.73132
+G1 X106.813 Y76.067 E1.75717
+G1 X110.620 Y77.644 E1.78533
+G1 X114.133 Y79.797 E1.81835
+G1 X117.266 Y82.473 E1.89628
+G1 X119.942 Y85.606 E1.94245
+G1 X122.095 Y89.119 E2.00005
+G1 X123.672 Y92.925 E2.03811
+G1 X124.633 Y96.932 E2.08854
+G1 F2100 E-4.41146
+G0 F9000 X124.957 Y101.039
+G1 F2100 E2.08854
+;TYPE:WALL-INNER
+G1 F1800
+G1 X124.709 Y98.509 E2.14360
+G1 X124.391 Y102.553 E2.21785
+G1 X123.444 Y106.497 E2.27877
+G1 X121.892 Y110.245 E2.35451
+G1 X119.772 Y113.704 E2.42589
+G1 X117.138 Y116.788 E2.50535
+G1 X114.053 Y119.423 E2.56563
+G1 X110.595 Y121.542 E2.59541
+G1 X106.847 Y123.095 E2.66705
+G1 X102.903 Y124.042 E2.74493
+G1 X98.859 Y124.360 E2.81921
+G1 X94.815 Y124.042 E2.87336
+G1 X90.870 Y123.095 E2.93618
+G1 X87.123 Y121.542 E2.96885
+G1 X83.664 Y119.423 E3.03875
+G1 X80.579 Y116.788 E3.09316
+G1 X77.945 Y113.704 E3.13026
+G1 X75.825 Y110.245 E3.15407
+G1 X74.273 Y106.497 E3.22530
+G1 X73.326 Y102.553 E3.30469
+G1 X73.008 Y98.509 E3.33000
+G1 X73.326 Y94.465 E3.39804
+G1 X74.273 Y90.521 E3.44266
+G1 X75.825 Y86.773 E3.47171
+G1 X77.945 Y83.314 E3.50934 ; segment
+G1 X80.579 Y80.230 E3.57547
+G1 X83.664 Y77.595 E3.64784
+G1 X87.123 Y75.476 E3.67049
+G1 X90.870 Y73.924 E3.72736
+G1 X94.815 Y72.977 E3.75006
+G1 X98.859 Y72.658 E3.81316
+G1 X102.903 Y72.977 E3.85302
+G1 X106.847 Y73.924 E3.92588
+G1 X110.595 Y75.476 E4.00471
+G1 X114.053 Y77.595 E4.05504
+G1 X117.138 Y80.230 E4.13495
+G1 X119.772 Y83.314 E4.17353
+G1 X121.892 Y86.773 E4.19815
+G1 X123.444 Y90.521 E4.25413
+G1 X124.391 Y94.465 E4.27602
+G1 F2100 E-2.22398
+G0 F9000 X124.709 Y98.509
+G1 F2100 E4.27602
+;TYPE:FILL
+G1 F2700
+G1 X123.079 Y99.079 E4.30539
+G1 X122.973 Y101.419 E4.32793
+G1 X122.659 Y103.741 E4.40000
+G1 X122.138 Y106.024 E4.43883
+G1 X121.414 Y108.252 E4.51635
+G1 X120.493 Y110.406 E4.59015
+G1 X119.383 Y112.468 E4.63282
+G1 X118.093 Y114.423 E4.68044
+G1 X116.633 Y116.255 E4.73165
+G1 X115.014 Y117.948 E4.79028
+G1 X113.250 Y119.489 E4.84602
+G1 X111.355 Y120.866 E4.89957
+G1 X109.344 Y122.067 E4.95678
+G1 X107.234 Y123.083 E5.03322
+G1 X105.041 Y123.906 E5.08364
+G1 X102.783 Y124.530 E5.12951
+G1 X100.478 Y124.948 E5.19273
+G1 X98.145 Y125.158 E5.22699
+G1 X95.803 Y125.158 E5.26505
+G1 X93.470 Y124.948 E5.34372
+G1 X91.165 Y124.530 E5.39499
+G1 X88.907 Y123.906 E5.44790
+G1 X86.714 Y123.083 E5.46858
+G1 X84.604 Y122.067 E5.51350
+G1 X82.593 Y120.866 E5.56829 ; segment
+G1 X80.698 Y119.489 E5.58950
+G1 X78.934 Y117.948 E5.64644
+G1 X77.315 Y116.255 E5.70438
+G1 X75.855 Y114.423 E5.72798
+G1 X74.564 Y112.468 E5.78562
+G1 X73.454 Y110.406 E5.83360
+G1 X72.534 Y108.252 E5.89435
+G1 X71.810 Y106.024 E5.93551
+G1 X71.289 Y103.741 E5.99792
+G1 X70.974 Y101.419 E6.06221
+G1 X70.869 Y99.079 E6.08354
+G1 X70.974 Y96.739 E6.10717
+G1 X71.289 Y94.418 E6.16773
+G1 X71.810 Y92.135 E6.24553
+G1 X72.534 Y89.907 E6.28060
+G1 X73.454 Y87.753 E6.32798
+G1 X74.564 Y85.690 E6.38354
+G1 X75.855 Y83.735 E6.42274
+G1 X77.315 Y81.904 E6.46458
+G1 X78.934 Y80.211 E6.50334
+G1 X80.698 Y78.670 E6.54549
+G1 X82.593 Y77.293 E6.60122
+G1 X84.604 Y76.092 E6.63925
+G1 X86.714 Y75.075 E6.68188
+G1 X88.907 Y74.252 E6.74821 ; segment
+G1 X91.165 Y73.629 E6.76983
+G1 X93.470 Y73.211 E6.82398
+G1 X95.803 Y73.001 E6.88810
+G1 X98.145 Y73.001 E6.92670
+G1 X100.478 Y73.211 E6.96005
+G1 X102.783 Y73.629 E7.02828
+G1 X105.041 Y74.252 E7.06260
+G1 X107.234 Y75.075 E7.09384
+G1 X109.344 Y76.092 E7.13996
+G1 X111.355 Y77.293 E7.20184
+G1 X113.250 Y78.670 E7.22795
+G1 X115.014 Y80.211 E7.26727
+G1 X116.633 Y81.904 E7.30729
+G1 X118.093 Y83.735 E7.37731
+G1 X119.383 Y85.690 E7.42361
+G1 X120.493 Y87.753 E7.49494
+G1 X121.414 Y89.907 E7.52510
+G1 X122.138 Y92.135 E7.56530
+G1 X122.659 Y94.418 E7.62432
+G1 X122.973 Y96.739 E7.69741
+G1 F2100 E1.19741
+G0 F9000 X123.079 Y99.079
+G1 F2100 E7.69741
+M105
+;LAYER:1
+G0 F9000 X98.044 Y89.001 Z0.400
+M106 S255
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X118.117 Y100.296 E7.76582
+G1 X117.848 Y103.723 E7.83613
+G1 X117.045 Y107.066 E7.86714
+G1 X115.729 Y110.242 E7.90386
+G1 X113.933 Y113.173 E7.97229
+G1 X111.701 Y115.788 E8.03081
+G1 X109.086 Y118.020 E8.09918
+G1 X106.155 Y119.816 E8.13990
+G1 X102.979 Y121.132 E8.16768
+G1 X99.636 Y121.935 E8.20520
+G1 X96.209 Y122.204 E8.27283
+G1 X92.782 Y121.935 E8.30910
+G1 X89.439 Y121.132 E8.34988
+G1 X86.263 Y119.816 E8.39490
+G1 X83.332 Y118.020 E8.44008
+G1 X80.718 Y115.788 E8.48465
+G1 X78.485 Y113.173 E8.55989
+G1 X76.689 Y110.242 E8.58925
+G1 X75.373 Y107.066 E8.60953
+G1 X74.571 Y103.723 E8.68613
+G1 X74.301 Y100.296 E8.75892
+G1 X74.571 Y96.869 E8.83814
+G1 X75.373 Y93.526 E8.88420
+G1 X76.689 Y90.350 E8.96121
+G1 X78.485 Y87.419 E9.03685 ; segment
+G1 X80.718 Y84.805 E9.07018
+G1 X83.332 Y82.572 E9.13491
+G1 X86.263 Y80.776 E9.20511
+G1 X89.439 Y79.460 E9.26489
+G1 X92.782 Y78.658 E9.31603
+G1 X96.209 Y78.388 E9.35337
+G1 X99.636 Y78.658 E9.39384
+G1 X102.979 Y79.460 E9.42749
+G1 X106.155 Y80.776 E9.45157
+G1 X109.086 Y82.572 E9.50689
+G1 X111.701 Y84.805 E9.54411
+G1 X113.933 Y87.419 E9.61272
+G1 X115.729 Y90.350 E9.63543
+G1 X117.045 Y93.526 E9.70964
+G1 X117.848 Y96.869 E9.77127
+G1 F2100 E3.27127
+G0 F9000 X118.117 Y100.296
+G1 F2100 E9.77127
+;TYPE:WALL-INNER
+G1 F1800
+G1 X133.235 Y103.966 E9.82588
+G1 X132.878 Y108.502 E9.84667
+G1 X131.816 Y112.926 E9.91139
+G1 X130.075 Y117.130 E9.94170
+G1 X127.697 Y121.010 E9.97969
+G1 X124.742 Y124.469 E10.03947
+G1 X121.282 Y127.425 E10.09096
+G1 X117.403 Y129.802 E10.13579
+G1 X113.199 Y131.543 E10.21213
+G1 X108.775 Y132.605 E10.26886
+G1 X104.239 Y132.962 E10.30934
+G1 X99.702 Y132.605 E10.34449
+G1 X95.278 Y131.543 E10.41619
+G1 X91.074 Y129.802 E10.46482
+G1 X87.195 Y127.425 E10.53176
+G1 X83.735 Y124.469 E10.57287
+G1 X80.780 Y121.010 E10.60471
+G1 X78.402 Y117.130 E10.65679
+G1 X76.661 Y112.926 E10.72580
+G1 X75.599 Y108.502 E10.75608
+G1 X75.242 Y103.966 E10.82358
+G1 X75.599 Y99.430 E10.89888
+G1 X76.661 Y95.005 E10.96725
+G1 X78.402 Y90.801 E11.03666
+G1 X80.780 Y86.922 E11.05711 ; segment
+G1 X83.735 Y83.462 E11.11482
+G1 X87.195 Y80.507 E11.18658
+G1 X91.074 Y78.129 E11.20957
+G1 X95.278 Y76.388 E11.24586
+G1 X99.702 Y75.326 E11.28197
+G1 X104.239 Y74.969 E11.33361
+G1 X108.775 Y75.326 E11.37899
+G1 X113.199 Y76.388 E11.42736
+G1 X117.403 Y78.129 E11.49395
+G1 X121.282 Y80.507 E11.51406
+G1 X124.742 Y83.462 E11.53735
+G1 X127.697 Y86.922 E11.56496
+G1 X130.075 Y90.801 E11.59244
+G1 X131.816 Y95.005 E11.61654
+G1 X132.878 Y99.430 E11.69503
+G1 F2100 E5.19503
+G0 F9000 X133.235 Y103.966
+G1 F2100 E11.69503
+;TYPE:FILL
+G1 F2700
+G1 X128.566 Y95.861 E11.73398
+G1 X128.465 Y98.104 E11.77285
+G1 X128.164 Y100.329 E11.81393
+G1 X127.664 Y102.518 E11.87275
+G1 X126.970 Y104.653 E11.92794
+G1 X126.088 Y106.718 E11.96959
+G1 X125.024 Y108.695 E12.00106
+G1 X123.787 Y110.568 E12.04078
+G1 X122.387 Y112.324 E12.06821
+G1 X120.836 Y113.946 E12.12154
+G1 X119.145 Y115.424 E12.18450
+G1 X117.329 Y116.743 E12.22732
+G1 X115.401 Y117.895 E12.25211
+G1 X113.378 Y118.869 E12.28283
+G1 X111.276 Y119.658 E12.32522
+G1 X109.112 Y120.255 E12.38149
+G1 X106.903 Y120.656 E12.44845
+G1 X104.667 Y120.857 E12.49126
+G1 X102.422 Y120.857 E12.55933
+G1 X100.186 Y120.656 E12.61671
+G1 X97.977 Y120.255 E12.66260
+G1 X95.813 Y119.658 E12.70495
+G1 X93.711 Y118.869 E12.75472
+G1 X91.688 Y117.895 E12.81689
+G1 X89.760 Y116.743 E12.86212 ; segment
+G1 X87.944 Y115.424 E12.92377
+G1 X86.253 Y113.946 E12.97142
+G1 X84.702 Y112.324 E13.00612
+G1 X83.302 Y110.568 E13.05827
+G1 X82.065 Y108.695 E13.11998
+G1 X81.001 Y106.718 E13.14428
+G1 X80.119 Y104.653 E13.18977
+G1 X79.425 Y102.518 E13.23532
+G1 X78.925 Y100.329 E13.30810
+G1 X78.624 Y98.104 E13.38429
+G1 X78.523 Y95.861 E13.42675
+G1 X78.624 Y93.618 E13.50062
+G1 X78.925 Y91.394 E13.56807
+G1 X79.425 Y89.205 E13.60380
+G1 X80.119 Y87.069 E13.65165
+G1 X81.001 Y85.005 E13.67904
+G1 X82.065 Y83.028 E13.74783
+G1 X83.302 Y81.154 E13.80757
+G1 X84.702 Y79.399 E13.88081
+G1 X86.253 Y77.776 E13.94836
+G1 X87.944 Y76.299 E14.00841
+G1 X89.760 Y74.979 E14.07244
+G1 X91.688 Y73.828 E14.12627
+G1 X93.711 Y72.854 E14.15246
+G1 X95.813 Y72.065 E14.20772 ; segment
+G1 X97.977 Y71.467 E14.22802
+G1 X100.186 Y71.067 E14.25663
+G1 X102.422 Y70.865 E14.32309
+G1 X104.667 Y70.865 E14.34574
+G1 X106.903 Y71.067 E14.37125
+G1 X109.112 Y71.467 E14.39721
+G1 X111.276 Y72.065 E14.47004
+G1 X113.378 Y72.854 E14.50079
+G1 X115.401 Y73.828 E14.52220
+G1 X117.329 Y74.979 E14.59269
+G1 X119.145 Y76.299 E14.61997
+G1 X120.836 Y77.776 E14.69060
+G1 X122.387 Y79.399 E14.75101
+G1 X123.787 Y81.154 E14.82119
+G1 X125.024 Y83.028 E14.89833
+G1 X126.088 Y85.005 E14.95308
+G1 X126.970 Y87.069 E15.02100
+G1 X127.664 Y89.205 E15.04318
+G1 X128.164 Y91.394 E15.10922
+G1 X128.465 Y93.618 E15.15990
+G1 F2100 E8.65990
+G0 F9000 X128.566 Y95.861
+G1 F2100 E15.15990
+M105
+;LAYER:2
+G0 F9000 X108.606 Y84.270 Z0.600
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X123.101 Y104.346 E15.19936
+G1 X122.847 Y107.570 E15.25319
+G1 X122.092 Y110.715 E15.32288
+G1 X120.855 Y113.703 E15.35741
+G1 X119.165 Y116.461 E15.38819
+G1 X117.064 Y118.920 E15.42319
+G1 X114.605 Y121.021 E15.48015
+G1 X111.847 Y122.711 E15.54536
+G1 X108.859 Y123.948 E15.58898
+G1 X105.714 Y124.703 E15.63103
+G1 X102.490 Y124.957 E15.67483
+G1 X99.265 Y124.703 E15.71585
+G1 X96.120 Y123.948 E15.76094
+G1 X93.132 Y122.711 E15.78594
+G1 X90.375 Y121.021 E15.83596
+G1 X87.915 Y118.920 E15.91434
+G1 X85.815 Y116.461 E15.95911
+G1 X84.125 Y113.703 E16.02395
+G1 X82.887 Y110.715 E16.05359
+G1 X82.132 Y107.570 E16.11504
+G1 X81.878 Y104.346 E16.18041
+G1 X82.132 Y101.121 E16.24084
+G1 X82.887 Y97.976 E16.29187
+G1 X84.125 Y94.988 E16.34089
+G1 X85.815 Y92.231 E16.39947 ; segment
+G1 X87.915 Y89.771 E16.47331
+G1 X90.375 Y87.671 E16.50227
+G1 X93.132 Y85.981 E16.52802
+G1 X96.120 Y84.743 E16.59291
+G1 X99.265 Y83.988 E16.66791
+G1 X102.490 Y83.734 E16.71894
+G1 X105.714 Y83.988 E16.76553
+G1 X108.859 Y84.743 E16.82866
+G1 X111.847 Y85.981 E16.85983
+G1 X114.605 Y87.671 E16.89587
+G1 X117.064 Y89.771 E16.92782
+G1 X119.165 Y92.231 E16.98296
+G1 X120.855 Y94.988 E17.02185
+G1 X122.092 Y97.976 E17.05579
+G1 X122.847 Y101.121 E17.11725
+G1 F2100 E10.61725
+G0 F9000 X123.101 Y104.346
+G1 F2100 E17.11725
+;TYPE:WALL-INNER
+G1 F1800
+G1 X131.588 Y97.959 E17.16205
+G1 X131.255 Y102.191 E17.23326
+G1 X130.264 Y106.319 E17.28834
+G1 X128.639 Y110.241 E17.32437
+G1 X126.421 Y113.860 E17.35743
+G1 X123.664 Y117.088 E17.37882
+G1 X120.436 Y119.845 E17.42759
+G1 X116.816 Y122.063 E17.47055
+G1 X112.894 Y123.688 E17.50089
+G1 X108.766 Y124.679 E17.54251
+G1 X104.534 Y125.012 E17.58184
+G1 X100.302 Y124.679 E17.64829
+G1 X96.174 Y123.688 E17.67691
+G1 X92.252 Y122.063 E17.75638
+G1 X88.633 Y119.845 E17.80515
+G1 X85.405 Y117.088 E17.86109
+G1 X82.648 Y113.860 E17.90918
+G1 X80.430 Y110.241 E17.97925
+G1 X78.805 Y106.319 E18.04855
+G1 X77.814 Y102.191 E18.10198
+G1 X77.481 Y97.959 E18.15086
+G1 X77.814 Y93.727 E18.21410
+G1 X78.805 Y89.599 E18.28550
+G1 X80.430 Y85.677 E18.32951
+G1 X82.648 Y82.057 E18.39353 ; segment
+G1 X85.405 Y78.829 E18.47114
+G1 X88.633 Y76.072 E18.51919
+G1 X92.252 Y73.854 E18.55296
+G1 X96.174 Y72.229 E18.58705
+G1 X100.302 Y71.238 E18.65011
+G1 X104.534 Y70.905 E18.71063
+G1 X108.766 Y71.238 E18.78816
+G1 X112.894 Y72.229 E18.85939
+G1 X116.816 Y73.854 E18.89391
+G1 X120.436 Y76.072 E18.92529
+G1 X123.664 Y78.829 E18.96081
+G1 X126.421 Y82.057 E18.99204
+G1 X128.639 Y85.677 E19.05432
+G1 X130.264 Y89.599 E19.12584
+G1 X131.255 Y93.727 E19.19983
+G1 F2100 E12.69983
+G0 F9000 X131.588 Y97.959
+G1 F2100 E19.19983
+;TYPE:FILL
+G1 F2700
+G1 X120.684 Y103.651 E19.24522
+G1 X120.591 Y105.725 E19.30896
+G1 X120.312 Y107.782 E19.33412
+G1 X119.851 Y109.806 E19.35968
+G1 X119.209 Y111.780 E19.42971
+G1 X118.393 Y113.689 E19.46722
+G1 X117.410 Y115.516 E19.50862
+G1 X116.266 Y117.249 E19.56343
+G1 X114.972 Y118.872 E19.62397
+G1 X113.537 Y120.372 E19.64438
+G1 X111.974 Y121.738 E19.68447
+G1 X110.295 Y122.958 E19.73064
+G1 X108.513 Y124.023 E19.77979
+G1 X106.642 Y124.923 E19.81240
+G1 X104.699 Y125.653 E19.86751
+G1 X102.698 Y126.205 E19.94483
+G1 X100.655 Y126.576 E19.98828
+G1 X98.588 Y126.762 E20.04094
+G1 X96.512 Y126.762 E20.06809
+G1 X94.445 Y126.576 E20.10458
+G1 X92.402 Y126.205 E20.16450
+G1 X90.401 Y125.653 E20.19126
+G1 X88.458 Y124.923 E20.26449
+G1 X86.588 Y124.023 E20.33901
+G1 X84.806 Y122.958 E20.36483 ; segment
+G1 X83.126 Y121.738 E20.44131
+G1 X81.563 Y120.372 E20.48376
+G1 X80.128 Y118.872 E20.55010
+G1 X78.834 Y117.249 E20.61554
+G1 X77.691 Y115.516 E20.65328
+G1 X76.707 Y113.689 E20.71383
+G1 X75.891 Y111.780 E20.77307
+G1 X75.250 Y109.806 E20.84144
+G1 X74.788 Y107.782 E20.87737
+G1 X74.509 Y105.725 E20.94262
+G1 X74.416 Y103.651 E21.02030
+G1 X74.509 Y101.577 E21.08067
+G1 X74.788 Y99.520 E21.13284
+G1 X75.250 Y97.496 E21.15964
+G1 X75.891 Y95.522 E21.20927
+G1 X76.707 Y93.613 E21.25040
+G1 X77.691 Y91.785 E21.31349
+G1 X78.834 Y90.053 E21.37420
+G1 X80.128 Y88.430 E21.42818
+G1 X81.563 Y86.930 E21.45910
+G1 X83.126 Y85.564 E21.51784
+G1 X84.806 Y84.344 E21.57570
+G1 X86.588 Y83.279 E21.60644
+G1 X88.458 Y82.378 E21.67984
+G1 X90.401 Y81.649 E21.73916 ; segment
+G1 X92.402 Y81.097 E21.76655
+G1 X94.445 Y80.726 E21.84246
+G1 X96.512 Y80.540 E21.87094
+G1 X98.588 Y80.540 E21.91083
+G1 X100.655 Y80.726 E21.97406
+G1 X102.698 Y81.097 E22.02991
+G1 X104.699 Y81.649 E22.08320
+G1 X106.642 Y82.378 E22.14205
+G1 X108.513 Y83.279 E22.18951
+G1 X110.295 Y84.344 E22.22826
+G1 X111.974 Y85.564 E22.25884
+G1 X113.537 Y86.930 E22.28296
+G1 X114.972 Y88.430 E22.34591
+G1 X116.266 Y90.053 E22.41118
+G1 X117.410 Y91.785 E22.46377
+G1 X118.393 Y93.613 E22.52815
+G1 X119.209 Y95.522 E22.56970
+G1 X119.851 Y97.496 E22.60565
+G1 X120.312 Y99.520 E22.64865
+G1 X120.591 Y101.577 E22.72100
+G1 F2100 E16.22100
+G0 F9000 X120.684 Y103.651
+G1 F2100 E22.72100
+M105
+;LAYER:3
+G0 F9000 X81.684 Y100.188 Z0.800
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X121.013 Y102.689 E22.76098
+G1 X120.723 Y106.372 E22.80518
+G1 X119.861 Y109.964 E22.85767
+G1 X118.447 Y113.376 E22.92397
+G1 X116.517 Y116.526 E22.96514
+G1 X114.118 Y119.335 E23.03596
+G1 X111.309 Y121.734 E23.06268
+G1 X108.159 Y123.664 E23.09891
+G1 X104.747 Y125.078 E23.12489
+G1 X101.155 Y125.940 E23.15165
+G1 X97.472 Y126.230 E23.21839
+G1 X93.789 Y125.940 E23.28203
+G1 X90.197 Y125.078 E23.31312
+G1 X86.785 Y123.664 E23.34447
+G1 X83.635 Y121.734 E23.38947
+G1 X80.826 Y119.335 E23.45407
+G1 X78.427 Y116.526 E23.52301
+G1 X76.497 Y113.376 E23.58793
+G1 X75.083 Y109.964 E23.64345
+G1 X74.221 Y106.372 E23.67224
+G1 X73.931 Y102.689 E23.71614
+G1 X74.221 Y99.006 E23.74776
+G1 X75.083 Y95.414 E23.79942
+G1 X76.497 Y92.002 E23.85352
+G1 X78.427 Y88.852 E23.88564 ; segment
+G1 X80.826 Y86.043 E23.92065
+G1 X83.635 Y83.644 E23.98755
+G1 X86.785 Y81.714 E24.00936
+G1 X90.197 Y80.300 E24.07755
+G1 X93.789 Y79.438 E24.15102
+G1 X97.472 Y79.148 E24.22798
+G1 X101.155 Y79.438 E24.27097
+G1 X104.747 Y80.300 E24.32412
+G1 X108.159 Y81.714 E24.37911
+G1 X111.309 Y83.644 E24.43713
+G1 X114.118 Y86.043 E24.51574
+G1 X116.517 Y88.852 E24.57694
+G1 X118.447 Y92.002 E24.61491
+G1 X119.861 Y95.414 E24.68651
+G1 X120.723 Y99.006 E24.73555
+G1 F2100 E18.23555
+G0 F9000 X121.013 Y102.689
+G1 F2100 E24.73555
+;TYPE:WALL-INNER
+G1 F1800
+G1 X121.037 Y102.268 E24.80178
+G1 X120.791 Y105.401 E24.86150
+G1 X120.057 Y108.456 E24.91101
+G1 X118.855 Y111.359 E24.96243
+G1 X117.213 Y114.038 E25.01006
+G1 X115.173 Y116.427 E25.04166
+G1 X112.783 Y118.468 E25.09344
+G1 X110.104 Y120.110 E25.11566
+G1 X107.201 Y121.312 E25.16569
+G1 X104.146 Y122.046 E25.22445
+G1 X101.014 Y122.292 E25.27110
+G1 X97.881 Y122.046 E25.32506
+G1 X94.826 Y121.312 E25.40260
+G1 X91.923 Y120.110 E25.47612
+G1 X89.244 Y118.468 E25.50426
+G1 X86.855 Y116.427 E25.57180
+G1 X84.814 Y114.038 E25.62920
+G1 X83.172 Y111.359 E25.65223
+G1 X81.970 Y108.456 E25.69383
+G1 X81.236 Y105.401 E25.72783
+G1 X80.990 Y102.268 E25.75250
+G1 X81.236 Y99.136 E25.80484
+G1 X81.970 Y96.081 E25.88063
+G1 X83.172 Y93.178 E25.92001
+G1 X84.814 Y90.499 E25.99224 ; segment
+G1 X86.855 Y88.109 E26.05392
+G1 X89.244 Y86.069 E26.08198
+G1 X91.923 Y84.427 E26.15348
+G1 X94.826 Y83.225 E26.20955
+G1 X97.881 Y82.491 E26.28517
+G1 X101.014 Y82.245 E26.34812
+G1 X104.146 Y82.491 E26.41251
+G1 X107.201 Y83.225 E26.45312
+G1 X110.104 Y84.427 E26.52152
+G1 X112.783 Y86.069 E26.59743
+G1 X115.173 Y88.109 E26.66912
+G1 X117.213 Y90.499 E26.71534
+G1 X118.855 Y93.178 E26.78075
+G1 X120.057 Y96.081 E26.82985
+G1 X120.791 Y99.136 E26.85640
+G1 F2100 E20.35640
+G0 F9000 X121.037 Y102.268
+G1 F2100 E26.85640
+;TYPE:FILL
+G1 F2700
+G1 X117.430 Y95.779 E26.88605
+G1 X117.341 Y97.752 E26.93587
+G1 X117.076 Y99.708 E26.99783
+G1 X116.637 Y101.633 E27.05008
+G1 X116.027 Y103.511 E27.09540
+G1 X115.251 Y105.326 E27.15436
+G1 X114.315 Y107.065 E27.19264
+G1 X113.228 Y108.712 E27.24050
+G1 X111.997 Y110.256 E27.30593
+G1 X110.632 Y111.683 E27.35001
+G1 X109.146 Y112.982 E27.38085
+G1 X107.548 Y114.143 E27.45481
+G1 X105.854 Y115.155 E27.51800
+G1 X104.075 Y116.012 E27.56001
+G1 X102.226 Y116.706 E27.60227
+G1 X100.323 Y117.231 E27.65403
+G1 X98.381 Y117.583 E27.70982
+G1 X96.414 Y117.760 E27.74325
+G1 X94.440 Y117.760 E27.76341
+G1 X92.473 Y117.583 E27.79595
+G1 X90.531 Y117.231 E27.86294
+G1 X88.628 Y116.706 E27.89155
+G1 X86.779 Y116.012 E27.93915
+G1 X85.000 Y115.155 E27.97087
+G1 X83.306 Y114.143 E28.00343 ; segment
+G1 X81.708 Y112.982 E28.03367
+G1 X80.222 Y111.683 E28.07790
+G1 X78.857 Y110.256 E28.10799
+G1 X77.626 Y108.712 E28.12964
+G1 X76.539 Y107.065 E28.15625
+G1 X75.603 Y105.326 E28.18634
+G1 X74.827 Y103.511 E28.23576
+G1 X74.217 Y101.633 E28.25934
+G1 X73.778 Y99.708 E28.28069
+G1 X73.513 Y97.752 E28.32757
+G1 X73.424 Y95.779 E28.37203
+G1 X73.513 Y93.807 E28.43424
+G1 X73.778 Y91.851 E28.45730
+G1 X74.217 Y89.926 E28.50150
+G1 X74.827 Y88.048 E28.54530
+G1 X75.603 Y86.233 E28.56690
+G1 X76.539 Y84.494 E28.64483
+G1 X77.626 Y82.846 E28.67797
+G1 X78.857 Y81.303 E28.70362
+G1 X80.222 Y79.876 E28.75210
+G1 X81.708 Y78.577 E28.78198
+G1 X83.306 Y77.416 E28.83933
+G1 X85.000 Y76.404 E28.88011
+G1 X86.779 Y75.547 E28.90755
+G1 X88.628 Y74.853 E28.93066 ; segment
+G1 X90.531 Y74.328 E28.99432
+G1 X92.473 Y73.976 E29.03083
+G1 X94.440 Y73.799 E29.09810
+G1 X96.414 Y73.799 E29.14602
+G1 X98.381 Y73.976 E29.22200
+G1 X100.323 Y74.328 E29.26003
+G1 X102.226 Y74.853 E29.29503
+G1 X104.075 Y75.547 E29.33098
+G1 X105.854 Y76.404 E29.39986
+G1 X107.548 Y77.416 E29.45760
+G1 X109.146 Y78.577 E29.49829
+G1 X110.632 Y79.876 E29.52391
+G1 X111.997 Y81.303 E29.58485
+G1 X113.228 Y82.846 E29.66301
+G1 X114.315 Y84.494 E29.71855
+G1 X115.251 Y86.233 E29.73877
+G1 X116.027 Y88.048 E29.76058
+G1 X116.637 Y89.926 E29.78602
+G1 X117.076 Y91.851 E29.81624
+G1 X117.341 Y93.807 E29.83843
+G1 F2100 E23.33843
+G0 F9000 X117.430 Y95.779
+G1 F2100 E29.83843
+M105
+;LAYER:4
+G0 F9000 X82.158 Y106.172 Z1.000
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X133.741 Y97.007 E29.88704
+G1 X133.375 Y101.659 E29.95526
+G1 X132.286 Y106.197 E30.03030
+G1 X130.500 Y110.508 E30.10671
+G1 X128.062 Y114.487 E30.12876
+G1 X125.031 Y118.035 E30.16704
+G1 X121.483 Y121.066 E30.22346
+G1 X117.504 Y123.504 E30.30025
+G1 X113.193 Y125.290 E30.32552
+G1 X108.655 Y126.379 E30.36312
+G1 X104.003 Y126.745 E30.43412
+G1 X99.351 Y126.379 E30.46100
+G1 X94.813 Y125.290 E30.50439
+G1 X90.502 Y123.504 E30.54444
+G1 X86.523 Y121.066 E30.60525
+G1 X82.975 Y118.035 E30.68096
+G1 X79.944 Y114.487 E30.71143
+G1 X77.506 Y110.508 E30.77582
+G1 X75.720 Y106.197 E30.83986
+G1 X74.631 Y101.659 E30.91000
+G1 X74.265 Y97.007 E30.96320
+G1 X74.631 Y92.355 E31.03861
+G1 X75.720 Y87.817 E31.08038
+G1 X77.506 Y83.506 E31.12526
+G1 X79.944 Y79.527 E31.15903 ; segment
+G1 X82.975 Y75.979 E31.22579
+G1 X86.523 Y72.948 E31.27463
+G1 X90.502 Y70.510 E31.31080
+G1 X94.813 Y68.724 E31.34098
+G1 X99.351 Y67.635 E31.40422
+G1 X104.003 Y67.268 E31.46056
+G1 X108.655 Y67.635 E31.52320
+G1 X113.193 Y68.724 E31.56641
+G1 X117.504 Y70.510 E31.61564
+G1 X121.483 Y72.948 E31.64487
+G1 X125.031 Y75.979 E31.70751
+G1 X128.062 Y79.527 E31.72889
+G1 X130.500 Y83.506 E31.77690
+G1 X132.286 Y87.817 E31.84241
+G1 X133.375 Y92.355 E31.90305
+G1 F2100 E25.40305
+G0 F9000 X133.741 Y97.007
+G1 F2100 E31.90305
+;TYPE:WALL-INNER
+G1 F1800
+G1 X124.407 Y97.372 E31.96159
+G1 X124.057 Y101.820 E32.03431
+G1 X123.016 Y106.159 E32.10664
+G1 X121.308 Y110.282 E32.15364
+G1 X118.977 Y114.086 E32.22745
+G1 X116.079 Y117.479 E32.29142
+G1 X112.685 Y120.377 E32.33144
+G1 X108.881 Y122.709 E32.37365
+G1 X104.758 Y124.416 E32.39797
+G1 X100.419 Y125.458 E32.44193
+G1 X95.971 Y125.808 E32.51927
+G1 X91.522 Y125.458 E32.54557
+G1 X87.183 Y124.416 E32.59971
+G1 X83.061 Y122.709 E32.62631
+G1 X79.256 Y120.377 E32.65117
+G1 X75.863 Y117.479 E32.71012
+G1 X72.965 Y114.086 E32.74456
+G1 X70.634 Y110.282 E32.76749
+G1 X68.926 Y106.159 E32.79665
+G1 X67.884 Y101.820 E32.85532
+G1 X67.534 Y97.372 E32.91045
+G1 X67.884 Y92.923 E32.93115
+G1 X68.926 Y88.584 E32.96495
+G1 X70.634 Y84.462 E33.04298
+G1 X72.965 Y80.657 E33.07619 ; segment
+G1 X75.863 Y77.264 E33.12994
+G1 X79.256 Y74.366 E33.17511
+G1 X83.061 Y72.035 E33.24198
+G1 X87.183 Y70.327 E33.29824
+G1 X91.522 Y69.285 E33.36556
+G1 X95.971 Y68.935 E33.41767
+G1 X100.419 Y69.285 E33.44896
+G1 X104.758 Y70.327 E33.47962
+G1 X108.881 Y72.035 E33.50437
+G1 X112.685 Y74.366 E33.57390
+G1 X116.079 Y77.264 E33.60065
+G1 X118.977 Y80.657 E33.62209
+G1 X121.308 Y84.462 E33.70008
+G1 X123.016 Y88.584 E33.73203
+G1 X124.057 Y92.923 E33.80563
+G1 F2100 E27.30563
+G0 F9000 X124.407 Y97.372
+G1 F2100 E33.80563
+;TYPE:FILL
+G1 F2700
+G1 X118.085 Y99.652 E33.87540
+G1 X117.996 Y101.645 E33.93232
+G1 X117.728 Y103.621 E33.99083
+G1 X117.284 Y105.566 E34.05651
+G1 X116.668 Y107.463 E34.12882
+G1 X115.884 Y109.297 E34.16958
+G1 X114.939 Y111.053 E34.22577
+G1 X113.840 Y112.717 E34.27250
+G1 X112.597 Y114.277 E34.29916
+G1 X111.218 Y115.718 E34.36928
+G1 X109.716 Y117.031 E34.42494
+G1 X108.103 Y118.203 E34.49383
+G1 X106.391 Y119.226 E34.52619
+G1 X104.594 Y120.091 E34.57854
+G1 X102.726 Y120.792 E34.62639
+G1 X100.804 Y121.323 E34.69007
+G1 X98.841 Y121.679 E34.71471
+G1 X96.855 Y121.857 E34.75548
+G1 X94.860 Y121.857 E34.80455
+G1 X92.874 Y121.679 E34.82884
+G1 X90.912 Y121.323 E34.88200
+G1 X88.989 Y120.792 E34.94612
+G1 X87.122 Y120.091 E34.99149
+G1 X85.325 Y119.226 E35.05040
+G1 X83.613 Y118.203 E35.10675 ; segment
+G1 X81.999 Y117.031 E35.13960
+G1 X80.497 Y115.718 E35.18063
+G1 X79.119 Y114.277 E35.26038
+G1 X77.875 Y112.717 E35.30049
+G1 X76.777 Y111.053 E35.34634
+G1 X75.831 Y109.297 E35.37139
+G1 X75.048 Y107.463 E35.40446
+G1 X74.431 Y105.566 E35.43438
+G1 X73.987 Y103.621 E35.51024
+G1 X73.720 Y101.645 E35.57382
+G1 X73.630 Y99.652 E35.64630
+G1 X73.720 Y97.660 E35.72550
+G1 X73.987 Y95.683 E35.78223
+G1 X74.431 Y93.739 E35.85811
+G1 X75.048 Y91.842 E35.91025
+G1 X75.831 Y90.008 E35.95537
+G1 X76.777 Y88.252 E36.03226
+G1 X77.875 Y86.587 E36.10644
+G1 X79.119 Y85.028 E36.18342
+G1 X80.497 Y83.586 E36.23247
+G1 X81.999 Y82.274 E36.29888
+G1 X83.613 Y81.102 E36.34330
+G1 X85.325 Y80.079 E36.42313
+G1 X87.122 Y79.214 E36.49835
+G1 X88.989 Y78.513 E36.53588 ; segment
+G1 X90.912 Y77.982 E36.61193
+G1 X92.874 Y77.626 E36.64300
+G1 X94.860 Y77.447 E36.66875
+G1 X96.855 Y77.447 E36.73210
+G1 X98.841 Y77.626 E36.76975
+G1 X100.804 Y77.982 E36.82092
+G1 X102.726 Y78.513 E36.87928
+G1 X104.594 Y79.214 E36.90171
+G1 X106.391 Y80.079 E36.96642
+G1 X108.103 Y81.102 E37.00298
+G1 X109.716 Y82.274 E37.04892
+G1 X111.218 Y83.586 E37.08961
+G1 X112.597 Y85.028 E37.15414
+G1 X113.840 Y86.587 E37.21894
+G1 X114.939 Y88.252 E37.25618
+G1 X115.884 Y90.008 E37.28238
+G1 X116.668 Y91.842 E37.32034
+G1 X117.284 Y93.739 E37.36501
+G1 X117.728 Y95.683 E37.38966
+G1 X117.996 Y97.660 E37.41885
+G1 F2100 E30.91885
+G0 F9000 X118.085 Y99.652
+G1 F2100 E37.41885
+M105
+;LAYER:5
+G0 F9000 X110.509 Y108.017 Z1.200
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X133.525 Y104.797 E37.46121
+G1 X133.171 Y109.296 E37.49089
+G1 X132.118 Y113.684 E37.52961
+G1 X130.391 Y117.854 E37.57740
+G1 X128.033 Y121.702 E37.62895
+G1 X125.101 Y125.134 E37.68148
+G1 X121.670 Y128.065 E37.72306
+G1 X117.821 Y130.423 E37.79422
+G1 X113.652 Y132.150 E37.83133
+G1 X109.263 Y133.204 E37.87912
+G1 X104.764 Y133.558 E37.95233
+G1 X100.265 Y133.204 E38.02076
+G1 X95.876 Y132.150 E38.05860
+G1 X91.707 Y130.423 E38.09316
+G1 X87.858 Y128.065 E38.16156
+G1 X84.427 Y125.134 E38.18216
+G1 X81.496 Y121.702 E38.21005
+G1 X79.137 Y117.854 E38.26190
+G1 X77.410 Y113.684 E38.31405
+G1 X76.357 Y109.296 E38.34400
+G1 X76.003 Y104.797 E38.36701
+G1 X76.357 Y100.297 E38.39925
+G1 X77.410 Y95.909 E38.46545
+G1 X79.137 Y91.739 E38.51339
+G1 X81.496 Y87.891 E38.59215 ; segment
+G1 X84.427 Y84.459 E38.65928
+G1 X87.858 Y81.528 E38.73804
+G1 X91.707 Y79.170 E38.76014
+G1 X95.876 Y77.443 E38.79125
+G1 X100.265 Y76.389 E38.81204
+G1 X104.764 Y76.035 E38.85798
+G1 X109.263 Y76.389 E38.89828
+G1 X113.652 Y77.443 E38.92135
+G1 X117.821 Y79.170 E38.97411
+G1 X121.670 Y81.528 E38.99974
+G1 X125.101 Y84.459 E39.03844
+G1 X128.033 Y87.891 E39.07327
+G1 X130.391 Y91.739 E39.14140
+G1 X132.118 Y95.909 E39.18649
+G1 X133.171 Y100.297 E39.22211
+G1 F2100 E32.72211
+G0 F9000 X133.525 Y104.797
+G1 F2100 E39.22211
+;TYPE:WALL-INNER
+G1 F1800
+G1 X121.715 Y99.296 E39.28263
+G1 X121.391 Y103.406 E39.35738
+G1 X120.429 Y107.415 E39.42590
+G1 X118.851 Y111.224 E39.46074
+G1 X116.697 Y114.740 E39.48888
+G1 X114.019 Y117.875 E39.55438
+G1 X110.884 Y120.552 E39.62175
+G1 X107.369 Y122.707 E39.67228
+G1 X103.559 Y124.284 E39.74214
+G1 X99.550 Y125.247 E39.79525
+G1 X95.440 Y125.570 E39.83202
+G1 X91.330 Y125.247 E39.86215
+G1 X87.321 Y124.284 E39.88317
+G1 X83.512 Y122.707 E39.94176
+G1 X79.996 Y120.552 E40.01557
+G1 X76.861 Y117.875 E40.08994
+G1 X74.183 Y114.740 E40.13799
+G1 X72.029 Y111.224 E40.19792
+G1 X70.451 Y107.415 E40.27364
+G1 X69.489 Y103.406 E40.34248
+G1 X69.165 Y99.296 E40.39864
+G1 X69.489 Y95.185 E40.44350
+G1 X70.451 Y91.176 E40.49461
+G1 X72.029 Y87.367 E40.52486
+G1 X74.183 Y83.852 E40.55583 ; segment
+G1 X76.861 Y80.717 E40.61686
+G1 X79.996 Y78.039 E40.69639
+G1 X83.512 Y75.885 E40.74921
+G1 X87.321 Y74.307 E40.79370
+G1 X91.330 Y73.344 E40.83481
+G1 X95.440 Y73.021 E40.88211
+G1 X99.550 Y73.344 E40.95029
+G1 X103.559 Y74.307 E40.99744
+G1 X107.369 Y75.885 E41.07499
+G1 X110.884 Y78.039 E41.10431
+G1 X114.019 Y80.717 E41.14320
+G1 X116.697 Y83.852 E41.19452
+G1 X118.851 Y87.367 E41.23924
+G1 X120.429 Y91.176 E41.31030
+G1 X121.391 Y95.185 E41.37996
+G1 F2100 E34.87996
+G0 F9000 X121.715 Y99.296
+G1 F2100 E41.37996
+;TYPE:FILL
+G1 F2700
+G1 X124.619 Y101.125 E41.43443
+G1 X124.537 Y102.945 E41.48741
+G1 X124.293 Y104.750 E41.53667
+G1 X123.887 Y106.527 E41.57346
+G1 X123.324 Y108.260 E41.63602
+G1 X122.608 Y109.935 E41.71072
+G1 X121.745 Y111.540 E41.73687
+G1 X120.741 Y113.060 E41.79699
+G1 X119.605 Y114.485 E41.83927
+G1 X118.346 Y115.802 E41.89015
+G1 X116.974 Y117.000 E41.96390
+G1 X115.500 Y118.071 E42.04152
+G1 X113.936 Y119.006 E42.10013
+G1 X112.294 Y119.797 E42.13183
+G1 X110.588 Y120.437 E42.20708
+G1 X108.832 Y120.921 E42.23794
+G1 X107.039 Y121.247 E42.28094
+G1 X105.224 Y121.410 E42.35063
+G1 X103.402 Y121.410 E42.38961
+G1 X101.588 Y121.247 E42.42586
+G1 X99.795 Y120.921 E42.50285
+G1 X98.038 Y120.437 E42.57948
+G1 X96.333 Y119.797 E42.61853
+G1 X94.691 Y119.006 E42.66208
+G1 X93.127 Y118.071 E42.69899 ; segment
+G1 X91.653 Y117.000 E42.72689
+G1 X90.281 Y115.802 E42.76190
+G1 X89.021 Y114.485 E42.84071
+G1 X87.885 Y113.060 E42.86546
+G1 X86.882 Y111.540 E42.89925
+G1 X86.018 Y109.935 E42.93125
+G1 X85.302 Y108.260 E42.95602
+G1 X84.739 Y106.527 E43.00760
+G1 X84.334 Y104.750 E43.07218
+G1 X84.089 Y102.945 E43.14247
+G1 X84.007 Y101.125 E43.20034
+G1 X84.089 Y99.304 E43.26941
+G1 X84.334 Y97.499 E43.28973
+G1 X84.739 Y95.723 E43.32666
+G1 X85.302 Y93.990 E43.40433
+G1 X86.018 Y92.314 E43.42850
+G1 X86.882 Y90.710 E43.46455
+G1 X87.885 Y89.189 E43.51352
+G1 X89.021 Y87.765 E43.54960
+G1 X90.281 Y86.448 E43.60236
+G1 X91.653 Y85.249 E43.62519
+G1 X93.127 Y84.178 E43.65935
+G1 X94.691 Y83.243 E43.73680
+G1 X96.333 Y82.453 E43.76546
+G1 X98.038 Y81.813 E43.83979 ; segment
+G1 X99.795 Y81.328 E43.87046
+G1 X101.588 Y81.002 E43.95003
+G1 X103.402 Y80.839 E44.01050
+G1 X105.224 Y80.839 E44.06932
+G1 X107.039 Y81.002 E44.09785
+G1 X108.832 Y81.328 E44.12113
+G1 X110.588 Y81.813 E44.18670
+G1 X112.294 Y82.453 E44.21727
+G1 X113.936 Y83.243 E44.24864
+G1 X115.500 Y84.178 E44.31800
+G1 X116.974 Y85.249 E44.39049
+G1 X118.346 Y86.448 E44.41342
+G1 X119.605 Y87.765 E44.49107
+G1 X120.741 Y89.189 E44.54315
+G1 X121.745 Y90.710 E44.58609
+G1 X122.608 Y92.314 E44.61252
+G1 X123.324 Y93.990 E44.65591
+G1 X123.887 Y95.723 E44.73516
+G1 X124.293 Y97.499 E44.77200
+G1 X124.537 Y99.304 E44.79988
+G1 F2100 E38.29988
+G0 F9000 X124.619 Y101.125
+G1 F2100 E44.79988
+M105
+;LAYER:6
+G0 F9000 X85.810 Y85.076 Z1.400
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X119.294 Y104.150 E44.83140
+G1 X119.038 Y107.399 E44.90776
+G1 X118.277 Y110.568 E44.98757
+G1 X117.030 Y113.579 E45.06637
+G1 X115.327 Y116.358 E45.10113
+G1 X113.211 Y118.836 E45.14239
+G1 X110.732 Y120.953 E45.21944
+G1 X107.953 Y122.656 E45.26854
+G1 X104.942 Y123.903 E45.33075
+G1 X101.773 Y124.664 E45.36954
+G1 X98.524 Y124.919 E45.39083
+G1 X95.275 Y124.664 E45.43155
+G1 X92.106 Y123.903 E45.49644
+G1 X89.095 Y122.656 E45.56335
+G1 X86.316 Y120.953 E45.61749
+G1 X83.838 Y118.836 E45.66533
+G1 X81.721 Y116.358 E45.71762
+G1 X80.018 Y113.579 E45.76416
+G1 X78.771 Y110.568 E45.81622
+G1 X78.010 Y107.399 E45.88620
+G1 X77.755 Y104.150 E45.91823
+G1 X78.010 Y100.901 E45.97389
+G1 X78.771 Y97.731 E46.04985
+G1 X80.018 Y94.720 E46.12075
+G1 X81.721 Y91.942 E46.15152 ; segment
+G1 X83.838 Y89.463 E46.22933
+G1 X86.316 Y87.347 E46.29973
+G1 X89.095 Y85.644 E46.32981
+G1 X92.106 Y84.397 E46.36576
+G1 X95.275 Y83.636 E46.39790
+G1 X98.524 Y83.380 E46.42109
+G1 X101.773 Y83.636 E46.49979
+G1 X104.942 Y84.397 E46.54435
+G1 X107.953 Y85.644 E46.61671
+G1 X110.732 Y87.347 E46.64358
+G1 X113.211 Y89.463 E46.66442
+G1 X115.327 Y91.942 E46.73660
+G1 X117.030 Y94.720 E46.80424
+G1 X118.277 Y97.731 E46.88374
+G1 X119.038 Y100.901 E46.94486
+G1 F2100 E40.44486
+G0 F9000 X119.294 Y104.150
+G1 F2100 E46.94486
+;TYPE:WALL-INNER
+G1 F1800
+G1 X121.178 Y102.660 E46.99729
+G1 X120.920 Y105.934 E47.04376
+G1 X120.153 Y109.127 E47.07254
+G1 X118.897 Y112.160 E47.12856
+G1 X117.181 Y114.960 E47.16795
+G1 X115.049 Y117.457 E47.21834
+G1 X112.552 Y119.589 E47.26075
+G1 X109.752 Y121.305 E47.29983
+G1 X106.719 Y122.561 E47.34134
+G1 X103.526 Y123.328 E47.39740
+G1 X100.252 Y123.586 E47.47623
+G1 X96.979 Y123.328 E47.55240
+G1 X93.786 Y122.561 E47.62413
+G1 X90.752 Y121.305 E47.69425
+G1 X87.953 Y119.589 E47.73145
+G1 X85.456 Y117.457 E47.81006
+G1 X83.323 Y114.960 E47.84624
+G1 X81.608 Y112.160 E47.87363
+G1 X80.351 Y109.127 E47.92368
+G1 X79.585 Y105.934 E47.98761
+G1 X79.327 Y102.660 E48.02808
+G1 X79.585 Y99.387 E48.08679
+G1 X80.351 Y96.194 E48.12374
+G1 X81.608 Y93.160 E48.20175
+G1 X83.323 Y90.361 E48.24893 ; segment
+G1 X85.456 Y87.864 E48.29760
+G1 X87.953 Y85.731 E48.34948
+G1 X90.752 Y84.016 E48.42198
+G1 X93.786 Y82.759 E48.50117
+G1 X96.979 Y81.993 E48.55288
+G1 X100.252 Y81.735 E48.59937
+G1 X103.526 Y81.993 E48.65644
+G1 X106.719 Y82.759 E48.68060
+G1 X109.752 Y84.016 E48.72612
+G1 X112.552 Y85.731 E48.79697
+G1 X115.049 Y87.864 E48.86362
+G1 X117.181 Y90.361 E48.88718
+G1 X118.897 Y93.160 E48.95845
+G1 X120.153 Y96.194 E49.00149
+G1 X120.920 Y99.387 E49.08037
+G1 F2100 E42.58037
+G0 F9000 X121.178 Y102.660
+G1 F2100 E49.08037
+;TYPE:FILL
+G1 F2700
+G1 X124.153 Y97.147 E49.15340
+G1 X124.051 Y99.431 E49.19926
+G1 X123.744 Y101.697 E49.27131
+G1 X123.235 Y103.927 E49.33399
+G1 X122.528 Y106.102 E49.37568
+G1 X121.629 Y108.205 E49.41372
+G1 X120.545 Y110.219 E49.46404
+G1 X119.286 Y112.127 E49.50798
+G1 X117.860 Y113.915 E49.55033
+G1 X116.279 Y115.568 E49.60944
+G1 X114.557 Y117.073 E49.68194
+G1 X112.707 Y118.417 E49.73701
+G1 X110.744 Y119.590 E49.76578
+G1 X108.683 Y120.583 E49.79898
+G1 X106.542 Y121.386 E49.84123
+G1 X104.338 Y121.995 E49.89811
+G1 X102.087 Y122.403 E49.92648
+G1 X99.810 Y122.608 E49.95138
+G1 X97.523 Y122.608 E49.99061
+G1 X95.245 Y122.403 E50.02759
+G1 X92.995 Y121.995 E50.04936
+G1 X90.790 Y121.386 E50.10169
+G1 X88.649 Y120.583 E50.17697
+G1 X86.589 Y119.590 E50.22903
+G1 X84.625 Y118.417 E50.29328 ; segment
+G1 X82.775 Y117.073 E50.36298
+G1 X81.053 Y115.568 E50.43324
+G1 X79.473 Y113.915 E50.50803
+G1 X78.047 Y112.127 E50.55451
+G1 X76.787 Y110.219 E50.61546
+G1 X75.703 Y108.205 E50.64270
+G1 X74.804 Y106.102 E50.71550
+G1 X74.098 Y103.927 E50.75819
+G1 X73.589 Y101.697 E50.80671
+G1 X73.282 Y99.431 E50.88013
+G1 X73.179 Y97.147 E50.91734
+G1 X73.282 Y94.862 E50.94873
+G1 X73.589 Y92.596 E51.01815
+G1 X74.098 Y90.366 E51.07408
+G1 X74.804 Y88.191 E51.09917
+G1 X75.703 Y86.088 E51.12085
+G1 X76.787 Y84.074 E51.16193
+G1 X78.047 Y82.166 E51.18238
+G1 X79.473 Y80.378 E51.25232
+G1 X81.053 Y78.725 E51.28334
+G1 X82.775 Y77.220 E51.31979
+G1 X84.625 Y75.876 E51.36312
+G1 X86.589 Y74.703 E51.41382
+G1 X88.649 Y73.710 E51.45976
+G1 X90.790 Y72.907 E51.51748 ; segment
+G1 X92.995 Y72.298 E51.57707
+G1 X95.245 Y71.890 E51.62324
+G1 X97.523 Y71.685 E51.64907
+G1 X99.810 Y71.685 E51.72781
+G1 X102.087 Y71.890 E51.78929
+G1 X104.338 Y72.298 E51.81430
+G1 X106.542 Y72.907 E51.86080
+G1 X108.683 Y73.710 E51.92601
+G1 X110.744 Y74.703 E52.00552
+G1 X112.707 Y75.876 E52.02948
+G1 X114.557 Y77.220 E52.05005
+G1 X116.279 Y78.725 E52.09885
+G1 X117.860 Y80.378 E52.14417
+G1 X119.286 Y82.166 E52.21784
+G1 X120.545 Y84.074 E52.28743
+G1 X121.629 Y86.088 E52.32732
+G1 X122.528 Y88.191 E52.37245
+G1 X123.235 Y90.366 E52.42742
+G1 X123.744 Y92.596 E52.50047
+G1 X124.051 Y94.862 E52.53258
+G1 F2100 E46.03258
+G0 F9000 X124.153 Y97.147
+G1 F2100 E52.53258
+M105
+;LAYER:7
+G0 F9000 X95.675 Y83.538 Z1.600
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X130.763 Y95.266 E52.58401
+G1 X130.402 Y99.857 E52.63844
+G1 X129.327 Y104.335 E52.66356
+G1 X127.564 Y108.590 E52.69749
+G1 X125.158 Y112.517 E52.74562
+G1 X122.167 Y116.019 E52.81706
+G1 X118.665 Y119.011 E52.86941
+G1 X114.738 Y121.417 E52.90648
+G1 X110.483 Y123.180 E52.98541
+G1 X106.004 Y124.255 E53.04509
+G1 X101.413 Y124.616 E53.09680
+G1 X96.821 Y124.255 E53.12894
+G1 X92.343 Y123.180 E53.16685
+G1 X88.088 Y121.417 E53.24084
+G1 X84.161 Y119.011 E53.26882
+G1 X80.659 Y116.019 E53.32071
+G1 X77.668 Y112.517 E53.37791
+G1 X75.261 Y108.590 E53.41920
+G1 X73.499 Y104.335 E53.48532
+G1 X72.424 Y99.857 E53.55992
+G1 X72.062 Y95.266 E53.63137
+G1 X72.424 Y90.674 E53.69565
+G1 X73.499 Y86.196 E53.72787
+G1 X75.261 Y81.941 E53.75146
+G1 X77.668 Y78.014 E53.79743 ; segment
+G1 X80.659 Y74.512 E53.83616
+G1 X84.161 Y71.521 E53.86779
+G1 X88.088 Y69.114 E53.94007
+G1 X92.343 Y67.352 E53.97304
+G1 X96.821 Y66.276 E54.04240
+G1 X101.413 Y65.915 E54.11866
+G1 X106.004 Y66.276 E54.14585
+G1 X110.483 Y67.352 E54.22066
+G1 X114.738 Y69.114 E54.26449
+G1 X118.665 Y71.521 E54.29721
+G1 X122.167 Y74.512 E54.32839
+G1 X125.158 Y78.014 E54.35066
+G1 X127.564 Y81.941 E54.40058
+G1 X129.327 Y86.196 E54.44364
+G1 X130.402 Y90.674 E54.51473
+G1 F2100 E48.01473
+G0 F9000 X130.763 Y95.266
+G1 F2100 E54.51473
+;TYPE:WALL-INNER
+G1 F1800
+G1 X127.343 Y95.570 E54.55808
+G1 X127.048 Y99.326 E54.58874
+G1 X126.168 Y102.990 E54.62378
+G1 X124.726 Y106.472 E54.65958
+G1 X122.757 Y109.685 E54.72123
+G1 X120.310 Y112.550 E54.76164
+G1 X117.445 Y114.997 E54.78831
+G1 X114.232 Y116.966 E54.82154
+G1 X110.751 Y118.408 E54.86807
+G1 X107.087 Y119.287 E54.92196
+G1 X103.330 Y119.583 E54.95669
+G1 X99.574 Y119.287 E55.01866
+G1 X95.910 Y118.408 E55.05159
+G1 X92.428 Y116.966 E55.11184
+G1 X89.216 Y114.997 E55.16840
+G1 X86.350 Y112.550 E55.19894
+G1 X83.903 Y109.685 E55.26401
+G1 X81.934 Y106.472 E55.30766
+G1 X80.492 Y102.990 E55.36003
+G1 X79.613 Y99.326 E55.41590
+G1 X79.317 Y95.570 E55.47359
+G1 X79.613 Y91.813 E55.52013
+G1 X80.492 Y88.149 E55.54349
+G1 X81.934 Y84.668 E55.61069
+G1 X83.903 Y81.455 E55.68227 ; segment
+G1 X86.350 Y78.590 E55.73168
+G1 X89.216 Y76.143 E55.78642
+G1 X92.428 Y74.174 E55.82253
+G1 X95.910 Y72.732 E55.89645
+G1 X99.574 Y71.852 E55.95759
+G1 X103.330 Y71.557 E55.99090
+G1 X107.087 Y71.852 E56.05995
+G1 X110.751 Y72.732 E56.13911
+G1 X114.232 Y74.174 E56.17987
+G1 X117.445 Y76.143 E56.25960
+G1 X120.310 Y78.590 E56.30859
+G1 X122.757 Y81.455 E56.33931
+G1 X124.726 Y84.668 E56.40233
+G1 X126.168 Y88.149 E56.44266
+G1 X127.048 Y91.813 E56.50660
+G1 F2100 E50.00660
+G0 F9000 X127.343 Y95.570
+G1 F2100 E56.50660
+;TYPE:FILL
+G1 F2700
+G1 X126.115 Y96.077 E56.57765
+G1 X126.013 Y98.343 E56.62632
+G1 X125.709 Y100.591 E56.67868
+G1 X125.204 Y102.802 E56.75046
+G1 X124.503 Y104.960 E56.79726
+G1 X123.612 Y107.045 E56.84683
+G1 X122.537 Y109.043 E56.90179
+G1 X121.287 Y110.936 E56.97123
+G1 X119.873 Y112.710 E57.00341
+G1 X118.305 Y114.349 E57.02903
+G1 X116.597 Y115.842 E57.09470
+G1 X114.762 Y117.175 E57.14785
+G1 X112.814 Y118.339 E57.18602
+G1 X110.770 Y119.323 E57.25955
+G1 X108.647 Y120.120 E57.33262
+G1 X106.460 Y120.723 E57.38511
+G1 X104.228 Y121.128 E57.46442
+G1 X101.969 Y121.332 E57.53457
+G1 X99.700 Y121.332 E57.59946
+G1 X97.441 Y121.128 E57.63693
+G1 X95.209 Y120.723 E57.65758
+G1 X93.022 Y120.120 E57.71830
+G1 X90.898 Y119.323 E57.78241
+G1 X88.855 Y118.339 E57.82345
+G1 X86.907 Y117.175 E57.87217 ; segment
+G1 X85.072 Y115.842 E57.92620
+G1 X83.364 Y114.349 E57.96119
+G1 X81.796 Y112.710 E58.02305
+G1 X80.382 Y110.936 E58.07680
+G1 X79.132 Y109.043 E58.11993
+G1 X78.057 Y107.045 E58.14651
+G1 X77.166 Y104.960 E58.19974
+G1 X76.465 Y102.802 E58.23893
+G1 X75.960 Y100.591 E58.30242
+G1 X75.655 Y98.343 E58.33277
+G1 X75.554 Y96.077 E58.37643
+G1 X75.655 Y93.810 E58.40821
+G1 X75.960 Y91.562 E58.45270
+G1 X76.465 Y89.351 E58.50729
+G1 X77.166 Y87.193 E58.53370
+G1 X78.057 Y85.108 E58.55699
+G1 X79.132 Y83.110 E58.60592
+G1 X80.382 Y81.217 E58.63802
+G1 X81.796 Y79.443 E58.68832
+G1 X83.364 Y77.804 E58.71835
+G1 X85.072 Y76.311 E58.74440
+G1 X86.907 Y74.978 E58.79665
+G1 X88.855 Y73.814 E58.87204
+G1 X90.898 Y72.830 E58.94416
+G1 X93.022 Y72.033 E58.99509 ; segment
+G1 X95.209 Y71.430 E59.03893
+G1 X97.441 Y71.025 E59.06289
+G1 X99.700 Y70.821 E59.09947
+G1 X101.969 Y70.821 E59.13833
+G1 X104.228 Y71.025 E59.21482
+G1 X106.460 Y71.430 E59.24185
+G1 X108.647 Y72.033 E59.31873
+G1 X110.770 Y72.830 E59.36733
+G1 X112.814 Y73.814 E59.41338
+G1 X114.762 Y74.978 E59.44911
+G1 X116.597 Y76.311 E59.52686
+G1 X118.305 Y77.804 E59.55803
+G1 X119.873 Y79.443 E59.61231
+G1 X121.287 Y81.217 E59.66296
+G1 X122.537 Y83.110 E59.69493
+G1 X123.612 Y85.108 E59.72830
+G1 X124.503 Y87.193 E59.80743
+G1 X125.204 Y89.351 E59.87488
+G1 X125.709 Y91.562 E59.93888
+G1 X126.013 Y93.810 E60.01306
+G1 F2100 E53.51306
+G0 F9000 X126.115 Y96.077
+G1 F2100 E60.01306
+M105
+;LAYER:8
+G0 F9000 X83.942 Y108.142 Z1.800
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X127.076 Y97.254 E60.09152
+G1 X126.773 Y101.097 E60.13113
+G1 X125.873 Y104.846 E60.19687
+G1 X124.398 Y108.408 E60.22679
+G1 X122.383 Y111.696 E60.28682
+G1 X119.879 Y114.628 E60.32298
+G1 X116.947 Y117.132 E60.37351
+G1 X113.660 Y119.146 E60.41585
+G1 X110.098 Y120.622 E60.48807
+G1 X106.349 Y121.522 E60.55277
+G1 X102.505 Y121.824 E60.60301
+G1 X98.661 Y121.522 E60.66425
+G1 X94.912 Y120.622 E60.70991
+G1 X91.350 Y119.146 E60.77816
+G1 X88.063 Y117.132 E60.81361
+G1 X85.131 Y114.628 E60.86626
+G1 X82.627 Y111.696 E60.92140
+G1 X80.613 Y108.408 E60.96468
+G1 X79.137 Y104.846 E60.98748
+G1 X78.237 Y101.097 E61.01768
+G1 X77.935 Y97.254 E61.07611
+G1 X78.237 Y93.410 E61.10879
+G1 X79.137 Y89.661 E61.17428
+G1 X80.613 Y86.099 E61.22457
+G1 X82.627 Y82.811 E61.30176 ; segment
+G1 X85.131 Y79.880 E61.37263
+G1 X88.063 Y77.376 E61.43627
+G1 X91.350 Y75.361 E61.47862
+G1 X94.912 Y73.886 E61.50123
+G1 X98.661 Y72.986 E61.55463
+G1 X102.505 Y72.683 E61.61937
+G1 X106.349 Y72.986 E61.69463
+G1 X110.098 Y73.886 E61.72679
+G1 X113.660 Y75.361 E61.75630
+G1 X116.947 Y77.376 E61.83513
+G1 X119.879 Y79.880 E61.89950
+G1 X122.383 Y82.811 E61.94857
+G1 X124.398 Y86.099 E62.01288
+G1 X125.873 Y89.661 E62.04185
+G1 X126.773 Y93.410 E62.09449
+G1 F2100 E55.59449
+G0 F9000 X127.076 Y97.254
+G1 F2100 E62.09449
+;TYPE:WALL-INNER
+G1 F1800
+G1 X123.298 Y101.038 E62.12270
+G1 X123.032 Y104.419 E62.18019
+G1 X122.240 Y107.716 E62.25325
+G1 X120.942 Y110.849 E62.28154
+G1 X119.171 Y113.741 E62.30196
+G1 X116.968 Y116.320 E62.32693
+G1 X114.389 Y118.522 E62.39404
+G1 X111.498 Y120.294 E62.43749
+G1 X108.365 Y121.592 E62.48484
+G1 X105.067 Y122.383 E62.56448
+G1 X101.686 Y122.649 E62.62115
+G1 X98.306 Y122.383 E62.65695
+G1 X95.008 Y121.592 E62.71900
+G1 X91.875 Y120.294 E62.73912
+G1 X88.983 Y118.522 E62.77602
+G1 X86.405 Y116.320 E62.83793
+G1 X84.202 Y113.741 E62.86818
+G1 X82.430 Y110.849 E62.89014
+G1 X81.132 Y107.716 E62.94124
+G1 X80.341 Y104.419 E62.98091
+G1 X80.075 Y101.038 E63.05918
+G1 X80.341 Y97.657 E63.08528
+G1 X81.132 Y94.359 E63.15341
+G1 X82.430 Y91.226 E63.19671
+G1 X84.202 Y88.335 E63.26504 ; segment
+G1 X86.405 Y85.756 E63.31175
+G1 X88.983 Y83.554 E63.37179
+G1 X91.875 Y81.782 E63.41139
+G1 X95.008 Y80.484 E63.44486
+G1 X98.306 Y79.692 E63.49201
+G1 X101.686 Y79.426 E63.56002
+G1 X105.067 Y79.692 E63.60074
+G1 X108.365 Y80.484 E63.63453
+G1 X111.498 Y81.782 E63.67949
+G1 X114.389 Y83.554 E63.70524
+G1 X116.968 Y85.756 E63.74418
+G1 X119.171 Y88.335 E63.79855
+G1 X120.942 Y91.226 E63.85128
+G1 X122.240 Y94.359 E63.90713
+G1 X123.032 Y97.657 E63.94453
+G1 F2100 E57.44453
+G0 F9000 X123.298 Y101.038
+G1 F2100 E63.94453
+;TYPE:FILL
+G1 F2700
+G1 X118.638 Y95.265 E63.97632
+G1 X118.544 Y97.362 E64.03046
+G1 X118.262 Y99.441 E64.06638
+G1 X117.795 Y101.488 E64.13209
+G1 X117.146 Y103.484 E64.18818
+G1 X116.322 Y105.414 E64.24792
+G1 X115.327 Y107.262 E64.31205
+G1 X114.171 Y109.013 E64.36335
+G1 X112.862 Y110.654 E64.40894
+G1 X111.412 Y112.171 E64.44745
+G1 X109.831 Y113.552 E64.47122
+G1 X108.133 Y114.786 E64.53889
+G1 X106.332 Y115.862 E64.58889
+G1 X104.441 Y116.773 E64.61488
+G1 X102.476 Y117.510 E64.69047
+G1 X100.453 Y118.069 E64.74539
+G1 X98.388 Y118.443 E64.80281
+G1 X96.297 Y118.631 E64.84913
+G1 X94.199 Y118.631 E64.87669
+G1 X92.108 Y118.443 E64.95667
+G1 X90.043 Y118.069 E64.98676
+G1 X88.020 Y117.510 E65.02873
+G1 X86.055 Y116.773 E65.10869
+G1 X84.164 Y115.862 E65.13602
+G1 X82.362 Y114.786 E65.18599 ; segment
+G1 X80.665 Y113.552 E65.23477
+G1 X79.084 Y112.171 E65.26962
+G1 X77.634 Y110.654 E65.34510
+G1 X76.325 Y109.013 E65.38995
+G1 X75.169 Y107.262 E65.41065
+G1 X74.174 Y105.414 E65.45906
+G1 X73.349 Y103.484 E65.47934
+G1 X72.701 Y101.488 E65.54185
+G1 X72.234 Y99.441 E65.61400
+G1 X71.952 Y97.362 E65.68834
+G1 X71.858 Y95.265 E65.71121
+G1 X71.952 Y93.168 E65.77173
+G1 X72.234 Y91.089 E65.81001
+G1 X72.701 Y89.042 E65.85837
+G1 X73.349 Y87.046 E65.89639
+G1 X74.174 Y85.116 E65.93470
+G1 X75.169 Y83.268 E65.96266
+G1 X76.325 Y81.517 E66.02020
+G1 X77.634 Y79.876 E66.04552
+G1 X79.084 Y78.359 E66.12337
+G1 X80.665 Y76.978 E66.14600
+G1 X82.362 Y75.744 E66.22384
+G1 X84.164 Y74.668 E66.25534
+G1 X86.055 Y73.757 E66.28034
+G1 X88.020 Y73.020 E66.34503 ; segment
+G1 X90.043 Y72.461 E66.39689
+G1 X92.108 Y72.087 E66.46302
+G1 X94.199 Y71.899 E66.51353
+G1 X96.297 Y71.899 E66.57136
+G1 X98.388 Y72.087 E66.59632
+G1 X100.453 Y72.461 E66.65675
+G1 X102.476 Y73.020 E66.70750
+G1 X104.441 Y73.757 E66.78523
+G1 X106.332 Y74.668 E66.80561
+G1 X108.133 Y75.744 E66.82970
+G1 X109.831 Y76.978 E66.89028
+G1 X111.412 Y78.359 E66.96585
+G1 X112.862 Y79.876 E67.01115
+G1 X114.171 Y81.517 E67.07381
+G1 X115.327 Y83.268 E67.12744
+G1 X116.322 Y85.116 E67.17089
+G1 X117.146 Y87.046 E67.21882
+G1 X117.795 Y89.042 E67.27492
+G1 X118.262 Y91.089 E67.29665
+G1 X118.544 Y93.168 E67.33499
+G1 F2100 E60.83499
+G0 F9000 X118.638 Y95.265
+G1 F2100 E67.33499
+M105
+;LAYER:9
+G0 F9000 X109.523 Y90.325 Z2.000
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X123.308 Y97.567 E67.39402
+G1 X123.017 Y101.255 E67.45864
+G1 X122.154 Y104.853 E67.53605
+G1 X120.738 Y108.271 E67.58466
+G1 X118.805 Y111.425 E67.61682
+G1 X116.402 Y114.238 E67.65704
+G1 X113.589 Y116.641 E67.68055
+G1 X110.435 Y118.574 E67.71492
+G1 X107.017 Y119.989 E67.77000
+G1 X103.420 Y120.853 E67.82666
+G1 X99.731 Y121.143 E67.86115
+G1 X96.043 Y120.853 E67.89205
+G1 X92.446 Y119.989 E67.91793
+G1 X89.028 Y118.574 E67.94865
+G1 X85.874 Y116.641 E67.99873
+G1 X83.061 Y114.238 E68.03404
+G1 X80.658 Y111.425 E68.10707
+G1 X78.725 Y108.271 E68.16096
+G1 X77.309 Y104.853 E68.20137
+G1 X76.446 Y101.255 E68.24723
+G1 X76.155 Y97.567 E68.26963
+G1 X76.446 Y93.879 E68.33360
+G1 X77.309 Y90.282 E68.39867
+G1 X78.725 Y86.864 E68.44049
+G1 X80.658 Y83.710 E68.50402 ; segment
+G1 X83.061 Y80.896 E68.54037
+G1 X85.874 Y78.494 E68.57353
+G1 X89.028 Y76.561 E68.60723
+G1 X92.446 Y75.145 E68.63903
+G1 X96.043 Y74.281 E68.69538
+G1 X99.731 Y73.991 E68.75391
+G1 X103.420 Y74.281 E68.81757
+G1 X107.017 Y75.145 E68.84380
+G1 X110.435 Y76.561 E68.90977
+G1 X113.589 Y78.494 E68.95847
+G1 X116.402 Y80.896 E69.00118
+G1 X118.805 Y83.710 E69.05136
+G1 X120.738 Y86.864 E69.09733
+G1 X122.154 Y90.282 E69.12934
+G1 X123.017 Y93.879 E69.17304
+G1 F2100 E62.67304
+G0 F9000 X123.308 Y97.567
+G1 F2100 E69.17304
+;TYPE:WALL-INNER
+G1 F1800
+G1 X130.611 Y102.152 E69.20470
+G1 X130.252 Y106.712 E69.27816
+G1 X129.184 Y111.160 E69.34618
+G1 X127.434 Y115.386 E69.40896
+G1 X125.044 Y119.286 E69.48773
+G1 X122.073 Y122.765 E69.51600
+G1 X118.595 Y125.735 E69.58260
+G1 X114.695 Y128.125 E69.65656
+G1 X110.469 Y129.876 E69.68388
+G1 X106.021 Y130.944 E69.73956
+G1 X101.461 Y131.302 E69.81638
+G1 X96.901 Y130.944 E69.85397
+G1 X92.453 Y129.876 E69.92528
+G1 X88.227 Y128.125 E69.99966
+G1 X84.327 Y125.735 E70.04577
+G1 X80.848 Y122.765 E70.07448
+G1 X77.878 Y119.286 E70.10741
+G1 X75.488 Y115.386 E70.17720
+G1 X73.737 Y111.160 E70.22253
+G1 X72.669 Y106.712 E70.26147
+G1 X72.311 Y102.152 E70.30805
+G1 X72.669 Y97.592 E70.38374
+G1 X73.737 Y93.144 E70.41898
+G1 X75.488 Y88.918 E70.44007
+G1 X77.878 Y85.018 E70.51702 ; segment
+G1 X80.848 Y81.540 E70.55604
+G1 X84.327 Y78.569 E70.59917
+G1 X88.227 Y76.179 E70.67772
+G1 X92.453 Y74.429 E70.71464
+G1 X96.901 Y73.361 E70.73978
+G1 X101.461 Y73.002 E70.81304
+G1 X106.021 Y73.361 E70.84767
+G1 X110.469 Y74.429 E70.88097
+G1 X114.695 Y76.179 E70.95723
+G1 X118.595 Y78.569 E70.99099
+G1 X122.073 Y81.540 E71.06506
+G1 X125.044 Y85.018 E71.10504
+G1 X127.434 Y88.918 E71.14324
+G1 X129.184 Y93.144 E71.17619
+G1 X130.252 Y97.592 E71.22873
+G1 F2100 E64.72873
+G0 F9000 X130.611 Y102.152
+G1 F2100 E71.22873
+;TYPE:FILL
+G1 F2700
+G1 X125.676 Y98.983 E71.26661
+G1 X125.575 Y101.231 E71.33687
+G1 X125.273 Y103.461 E71.41291
+G1 X124.772 Y105.654 E71.47809
+G1 X124.077 Y107.794 E71.54728
+G1 X123.192 Y109.863 E71.57152
+G1 X122.126 Y111.844 E71.60654
+G1 X120.887 Y113.722 E71.63876
+G1 X119.484 Y115.481 E71.66805
+G1 X117.929 Y117.107 E71.74616
+G1 X116.235 Y118.587 E71.82047
+G1 X114.415 Y119.910 E71.89532
+G1 X112.483 Y121.064 E71.94879
+G1 X110.456 Y122.040 E71.97578
+G1 X108.350 Y122.830 E72.02141
+G1 X106.181 Y123.429 E72.04478
+G1 X103.967 Y123.831 E72.11906
+G1 X101.726 Y124.032 E72.15499
+G1 X99.476 Y124.032 E72.19228
+G1 X97.236 Y123.831 E72.26902
+G1 X95.022 Y123.429 E72.30105
+G1 X92.853 Y122.830 E72.37641
+G1 X90.746 Y122.040 E72.41508
+G1 X88.719 Y121.064 E72.47497
+G1 X86.788 Y119.910 E72.50137 ; segment
+G1 X84.968 Y118.587 E72.57527
+G1 X83.273 Y117.107 E72.61919
+G1 X81.719 Y115.481 E72.65989
+G1 X80.316 Y113.722 E72.71916
+G1 X79.076 Y111.844 E72.77476
+G1 X78.010 Y109.863 E72.80982
+G1 X77.126 Y107.794 E72.83727
+G1 X76.431 Y105.654 E72.89180
+G1 X75.930 Y103.461 E72.91328
+G1 X75.628 Y101.231 E72.98556
+G1 X75.527 Y98.983 E73.02619
+G1 X75.628 Y96.736 E73.05637
+G1 X75.930 Y94.506 E73.09604
+G1 X76.431 Y92.313 E73.12287
+G1 X77.126 Y90.173 E73.16187
+G1 X78.010 Y88.104 E73.21446
+G1 X79.076 Y86.123 E73.25887
+G1 X80.316 Y84.245 E73.29893
+G1 X81.719 Y82.486 E73.33637
+G1 X83.273 Y80.860 E73.38556
+G1 X84.968 Y79.380 E73.45229
+G1 X86.788 Y78.057 E73.49855
+G1 X88.719 Y76.903 E73.56462
+G1 X90.746 Y75.927 E73.61358
+G1 X92.853 Y75.136 E73.64080 ; segment
+G1 X95.022 Y74.538 E73.67102
+G1 X97.236 Y74.136 E73.74188
+G1 X99.476 Y73.934 E73.79063
+G1 X101.726 Y73.934 E73.83358
+G1 X103.967 Y74.136 E73.88452
+G1 X106.181 Y74.538 E73.95529
+G1 X108.350 Y75.136 E73.99781
+G1 X110.456 Y75.927 E74.03951
+G1 X112.483 Y76.903 E74.08147
+G1 X114.415 Y78.057 E74.10211
+G1 X116.235 Y79.380 E74.15480
+G1 X117.929 Y80.860 E74.20355
+G1 X119.484 Y82.486 E74.25330
+G1 X120.887 Y84.245 E74.30040
+G1 X122.126 Y86.123 E74.34874
+G1 X123.192 Y88.104 E74.41167
+G1 X124.077 Y90.173 E74.44284
+G1 X124.772 Y92.313 E74.52172
+G1 X125.273 Y94.506 E74.54860
+G1 X125.575 Y96.736 E74.62058
+G1 F2100 E68.12058
+G0 F9000 X125.676 Y98.983
+G1 F2100 E74.62058
+M105
+;LAYER:10
+G0 F9000 X87.002 Y111.808 Z2.200
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X123.012 Y95.782 E74.69092
+G1 X122.699 Y99.757 E74.76165
+G1 X121.768 Y103.633 E74.83427
+G1 X120.243 Y107.317 E74.91305
+G1 X118.160 Y110.716 E74.93624
+G1 X115.571 Y113.748 E74.97899
+G1 X112.539 Y116.337 E75.00540
+G1 X109.140 Y118.420 E75.07071
+G1 X105.456 Y119.946 E75.11780
+G1 X101.580 Y120.876 E75.18244
+G1 X97.605 Y121.189 E75.25019
+G1 X93.631 Y120.876 E75.33013
+G1 X89.754 Y119.946 E75.39074
+G1 X86.071 Y118.420 E75.46325
+G1 X82.671 Y116.337 E75.51616
+G1 X79.640 Y113.748 E75.54100
+G1 X77.051 Y110.716 E75.61447
+G1 X74.968 Y107.317 E75.63993
+G1 X73.442 Y103.633 E75.66508
+G1 X72.511 Y99.757 E75.73490
+G1 X72.198 Y95.782 E75.77173
+G1 X72.511 Y91.808 E75.83147
+G1 X73.442 Y87.931 E75.85319
+G1 X74.968 Y84.248 E75.88584
+G1 X77.051 Y80.849 E75.94878 ; segment
+G1 X79.640 Y77.817 E75.97104
+G1 X82.671 Y75.228 E76.02168
+G1 X86.071 Y73.145 E76.09793
+G1 X89.754 Y71.619 E76.13078
+G1 X93.631 Y70.688 E76.19307
+G1 X97.605 Y70.376 E76.25770
+G1 X101.580 Y70.688 E76.31490
+G1 X105.456 Y71.619 E76.38088
+G1 X109.140 Y73.145 E76.44277
+G1 X112.539 Y75.228 E76.46363
+G1 X115.571 Y77.817 E76.49514
+G1 X118.160 Y80.849 E76.54732
+G1 X120.243 Y84.248 E76.62551
+G1 X121.768 Y87.931 E76.65853
+G1 X122.699 Y91.808 E76.71374
+G1 F2100 E70.21374
+G0 F9000 X123.012 Y95.782
+G1 F2100 E76.71374
+;TYPE:WALL-INNER
+G1 F1800
+G1 X120.735 Y103.468 E76.76506
+G1 X120.434 Y107.293 E76.82522
+G1 X119.538 Y111.024 E76.85341
+G1 X118.070 Y114.569 E76.91714
+G1 X116.065 Y117.841 E76.98513
+G1 X113.573 Y120.758 E77.05671
+G1 X110.655 Y123.250 E77.09359
+G1 X107.384 Y125.255 E77.12765
+G1 X103.839 Y126.723 E77.15755
+G1 X100.108 Y127.619 E77.23151
+G1 X96.283 Y127.920 E77.27780
+G1 X92.458 Y127.619 E77.32118
+G1 X88.727 Y126.723 E77.37241
+G1 X85.183 Y125.255 E77.43432
+G1 X81.911 Y123.250 E77.47341
+G1 X78.993 Y120.758 E77.51359
+G1 X76.502 Y117.841 E77.57956
+G1 X74.497 Y114.569 E77.64616
+G1 X73.029 Y111.024 E77.68392
+G1 X72.133 Y107.293 E77.70834
+G1 X71.832 Y103.468 E77.78402
+G1 X72.133 Y99.643 E77.84780
+G1 X73.029 Y95.912 E77.90346
+G1 X74.497 Y92.368 E77.94774
+G1 X76.502 Y89.096 E78.02527 ; segment
+G1 X78.993 Y86.179 E78.07110
+G1 X81.911 Y83.687 E78.10410
+G1 X85.183 Y81.682 E78.13012
+G1 X88.727 Y80.214 E78.17118
+G1 X92.458 Y79.318 E78.22723
+G1 X96.283 Y79.017 E78.26910
+G1 X100.108 Y79.318 E78.34592
+G1 X103.839 Y80.214 E78.40491
+G1 X107.384 Y81.682 E78.45240
+G1 X110.655 Y83.687 E78.51202
+G1 X113.573 Y86.179 E78.56813
+G1 X116.065 Y89.096 E78.62518
+G1 X118.070 Y92.368 E78.67490
+G1 X119.538 Y95.912 E78.72628
+G1 X120.434 Y99.643 E78.77575
+G1 F2100 E72.27575
+G0 F9000 X120.735 Y103.468
+G1 F2100 E78.77575
+;TYPE:FILL
+G1 F2700
+G1 X131.168 Y96.919 E78.81365
+G1 X131.056 Y99.416 E78.88458
+G1 X130.721 Y101.892 E78.90895
+G1 X130.164 Y104.329 E78.95805
+G1 X129.392 Y106.706 E79.00462
+G1 X128.410 Y109.004 E79.06731
+G1 X127.225 Y111.205 E79.09946
+G1 X125.848 Y113.291 E79.13521
+G1 X124.290 Y115.245 E79.16318
+G1 X122.563 Y117.052 E79.21687
+G1 X120.681 Y118.696 E79.27146
+G1 X118.659 Y120.165 E79.29149
+G1 X116.513 Y121.447 E79.32217
+G1 X114.261 Y122.532 E79.35414
+G1 X111.921 Y123.410 E79.43158
+G1 X109.512 Y124.075 E79.47888
+G1 X107.053 Y124.521 E79.53281
+G1 X104.563 Y124.745 E79.57019
+G1 X102.064 Y124.745 E79.62977
+G1 X99.575 Y124.521 E79.69855
+G1 X97.115 Y124.075 E79.75882
+G1 X94.706 Y123.410 E79.77891
+G1 X92.366 Y122.532 E79.82528
+G1 X90.114 Y121.447 E79.87461
+G1 X87.968 Y120.165 E79.89728 ; segment
+G1 X85.946 Y118.696 E79.96468
+G1 X84.064 Y117.052 E80.00381
+G1 X82.337 Y115.245 E80.04141
+G1 X80.779 Y113.291 E80.09893
+G1 X79.402 Y111.205 E80.15401
+G1 X78.217 Y109.004 E80.20380
+G1 X77.235 Y106.706 E80.27536
+G1 X76.463 Y104.329 E80.32649
+G1 X75.907 Y101.892 E80.36708
+G1 X75.571 Y99.416 E80.39094
+G1 X75.459 Y96.919 E80.44412
+G1 X75.571 Y94.422 E80.48593
+G1 X75.907 Y91.945 E80.53812
+G1 X76.463 Y89.508 E80.57897
+G1 X77.235 Y87.131 E80.59938
+G1 X78.217 Y84.833 E80.62165
+G1 X79.402 Y82.632 E80.65112
+G1 X80.779 Y80.546 E80.67676
+G1 X82.337 Y78.592 E80.74784
+G1 X84.064 Y76.786 E80.80269
+G1 X85.946 Y75.141 E80.83700
+G1 X87.968 Y73.672 E80.89964
+G1 X90.114 Y72.390 E80.95771
+G1 X92.366 Y71.306 E80.98143
+G1 X94.706 Y70.427 E81.04650 ; segment
+G1 X97.115 Y69.762 E81.08023
+G1 X99.575 Y69.316 E81.16007
+G1 X102.064 Y69.092 E81.18859
+G1 X104.563 Y69.092 E81.22574
+G1 X107.053 Y69.316 E81.26069
+G1 X109.512 Y69.762 E81.33242
+G1 X111.921 Y70.427 E81.40153
+G1 X114.261 Y71.306 E81.45630
+G1 X116.513 Y72.390 E81.48524
+G1 X118.659 Y73.672 E81.53095
+G1 X120.681 Y75.141 E81.59307
+G1 X122.563 Y76.786 E81.61655
+G1 X124.290 Y78.592 E81.69181
+G1 X125.848 Y80.546 E81.76229
+G1 X127.225 Y82.632 E81.83819
+G1 X128.410 Y84.833 E81.90010
+G1 X129.392 Y87.131 E81.95716
+G1 X130.164 Y89.508 E82.03567
+G1 X130.721 Y91.945 E82.07168
+G1 X131.056 Y94.422 E82.11001
+G1 F2100 E75.61001
+G0 F9000 X131.168 Y96.919
+G1 F2100 E82.11001
+M105
+;LAYER:11
+G0 F9000 X84.927 Y87.216 Z2.400
+;TYPE:WALL-OUTER
+G1 F1800
+G1 X130.426 Y95.952 E82.15379
+G1 X130.088 Y100.245 E82.22645
+G1 X129.083 Y104.432 E82.29202
+G1 X127.435 Y108.410 E82.35323
+G1 X125.185 Y112.082 E82.42393
+G1 X122.389 Y115.356 E82.44649
+G1 X119.114 Y118.153 E82.48241
+G1 X115.443 Y120.403 E82.52453
+G1 X111.464 Y122.051 E82.57029
+G1 X107.277 Y123.056 E82.63051
+G1 X102.985 Y123.394 E82.70326
+G1 X98.692 Y123.056 E82.76766
+G1 X94.505 Y122.051 E82.84338
+G1 X90.527 Y120.403 E82.90514
+G1 X86.855 Y118.153 E82.94653
+G1 X83.581 Y115.356 E82.99700
+G1 X80.784 Y112.082 E83.06191
+G1 X78.534 Y108.410 E83.13081
+G1 X76.886 Y104.432 E83.17300
+G1 X75.881 Y100.245 E83.21432
+G1 X75.543 Y95.952 E83.27119
+G1 X75.881 Y91.660 E83.30490
+G1 X76.886 Y87.472 E83.37787
+G1 X78.534 Y83.494 E83.39788
+G1 X80.784 Y79.823 E83.45680 ; segment
+G1 X83.581 Y76.548 E83.50594
+G1 X86.855 Y73.752 E83.53764
+G1 X90.527 Y71.502 E83.59185
+G1 X94.505 Y69.854 E83.64030
+G1 X98.692 Y68.849 E83.71803
+G1 X102.985 Y68.511 E83.79110
+G1 X107.277 Y68.849 E83.84630
+G1 X111.464 Y69.854 E83.91858
+G1 X115.443 Y71.502 E83.99160
+G1 X119.114 Y73.752 E84.02151
+G1 X122.389 Y76.548 E84.09115
+G1 X125.185 Y79.823 E84.16116
+G1 X127.435 Y83.494 E84.24061
+G1 X129.083 Y87.472 E84.30618
+G1 X130.088 Y91.660 E84.34971
+G1 F2100 E77.84971
+G0 F9000 X130.426 Y95.952
+G1 F2100 E84.34971
+;TYPE:WALL-INNER
+G1 F1800
+G1 X119.171 Y101.528 E84.41514
+G1 X118.899 Y104.987 E84.46960
+G1 X118.089 Y108.360 E84.53915
+G1 X116.761 Y111.565 E84.58054
+G1 X114.949 Y114.523 E84.61872
+G1 X112.696 Y117.161 E84.69299
+G1 X110.058 Y119.413 E84.75274
+G1 X107.100 Y121.226 E84.79543
+G1 X103.895 Y122.554 E84.84907
+G1 X100.522 Y123.363 E84.89520
+G1 X97.064 Y123.636 E84.95378
+G1 X93.606 Y123.363 E85.00479
+G1 X90.232 Y122.554 E85.04192
+G1 X87.027 Y121.226 E85.12070
+G1 X84.070 Y119.413 E85.19382
+G1 X81.432 Y117.161 E85.25934
+G1 X79.179 Y114.523 E85.29603
+G1 X77.366 Y111.565 E85.32768
+G1 X76.039 Y108.360 E85.39155
+G1 X75.229 Y104.987 E85.46089
+G1 X74.957 Y101.528 E85.52005
+G1 X75.229 Y98.070 E85.55286
+G1 X76.039 Y94.697 E85.61609
+G1 X77.366 Y91.492 E85.66748
+G1 X79.179 Y88.534 E85.70988 ; segment
+G1 X81.432 Y85.896 E85.76522
+G1 X84.070 Y83.643 E85.81214
+G1 X87.027 Y81.831 E85.87107
+G1 X90.232 Y80.503 E85.93617
+G1 X93.606 Y79.693 E86.01513
+G1 X97.064 Y79.421 E86.04180
+G1 X100.522 Y79.693 E86.09607
+G1 X103.895 Y80.503 E86.17279
+G1 X107.100 Y81.831 E86.23221
+G1 X110.058 Y83.643 E86.28699
+G1 X112.696 Y85.896 E86.35817
+G1 X114.949 Y88.534 E86.38005
+G1 X116.761 Y91.492 E86.44761
+G1 X118.089 Y94.697 E86.50500
+G1 X118.899 Y98.070 E86.56006
+G1 F2100 E80.06006
+G0 F9000 X119.171 Y101.528
+G1 F2100 E86.56006
+;TYPE:FILL
+G1 F2700
+G1 X119.361 Y101.192 E86.61159
+G1 X119.275 Y103.097 E86.64705
+G1 X119.019 Y104.987 E86.72295
+G1 X118.595 Y106.847 E86.79123
+G1 X118.005 Y108.660 E86.83960
+G1 X117.256 Y110.414 E86.90490
+G1 X116.352 Y112.093 E86.94799
+G1 X115.301 Y113.685 E86.99941
+G1 X114.112 Y115.176 E87.02910
+G1 X112.795 Y116.554 E87.10057
+G1 X111.358 Y117.809 E87.16641
+G1 X109.815 Y118.930 E87.23201
+G1 X108.178 Y119.908 E87.25701
+G1 X106.460 Y120.736 E87.32618
+G1 X104.675 Y121.406 E87.34690
+G1 X102.836 Y121.913 E87.40081
+G1 X100.960 Y122.254 E87.45007
+G1 X99.060 Y122.425 E87.47363
+G1 X97.153 Y122.425 E87.51893
+G1 X95.254 Y122.254 E87.59216
+G1 X93.377 Y121.913 E87.64962
+G1 X91.539 Y121.406 E87.68848
+G1 X89.754 Y120.736 E87.75735
+G1 X88.035 Y119.908 E87.79867
+G1 X86.398 Y118.930 E87.87249 ; segment
+G1 X84.855 Y117.809 E87.91655
+G1 X83.419 Y116.554 E87.94120
+G1 X82.101 Y115.176 E88.01951
+G1 X80.912 Y113.685 E88.04377
+G1 X79.862 Y112.093 E88.07895
+G1 X78.958 Y110.414 E88.14522
+G1 X78.208 Y108.660 E88.17213
+G1 X77.619 Y106.847 E88.22478
+G1 X77.195 Y104.987 E88.29632
+G1 X76.939 Y103.097 E88.35172
+G1 X76.853 Y101.192 E88.39260
+G1 X76.939 Y99.287 E88.45809
+G1 X77.195 Y97.397 E88.52762
+G1 X77.619 Y95.538 E88.58238
+G1 X78.208 Y93.724 E88.64000
+G1 X78.958 Y91.971 E88.67934
+G1 X79.862 Y90.291 E88.72379
+G1 X80.912 Y88.700 E88.80330
+G1 X82.101 Y87.209 E88.88161
+G1 X83.419 Y85.830 E88.90171
+G1 X84.855 Y84.576 E88.93349
+G1 X86.398 Y83.455 E88.96700
+G1 X88.035 Y82.476 E89.03458
+G1 X89.754 Y81.649 E89.06661
+G1 X91.539 Y80.979 E89.09678 ; segment
+G1 X93.377 Y80.471 E89.16273
+G1 X95.254 Y80.131 E89.19286
+G1 X97.153 Y79.960 E89.27150
+G1 X99.060 Y79.960 E89.31883
+G1 X100.960 Y80.131 E89.39274
+G1 X102.836 Y80.471 E89.46192
+G1 X104.675 Y80.979 E89.49435
+G1 X106.460 Y81.649 E89.56149
+G1 X108.178 Y82.476 E89.60639
+G1 X109.815 Y83.455 E89.63972
+G1 X111.358 Y84.576 E89.66248
+G1 X112.795 Y85.830 E89.72467
+G1 X114.112 Y87.209 E89.77834
+G1 X115.301 Y88.700 E89.81653
+G1 X116.352 Y90.291 E89.88649
+G1 X117.256 Y91.971 E89.91832
+G1 X118.005 Y93.724 E89.96500
+G1 X118.595 Y95.538 E89.99024
+G1 X119.019 Y97.397 E90.03126
+G1 X119.275 Y99.287 E90.10434
+G1 F2100 E83.60434
+G0 F9000 X119.361 Y101.192
+G1 F2100 E90.10434
+M105
+M107
+G91
+G1 E-1 F300
+G1 Z+0.5 E-5 X-20 Y-20 F9000
+G28 X0 Y0
+M84
+G90
+;End of Gcode
@@ -0,0 +1,478 @@
+/*
+  printer_sim.cpp - scripted fake printer for host tests
+*/
+
+#include "printer_sim.h"
+#include <deque>
+
+#define NEVER ((uint64_t) -1)
+
+typedef struct {
+    uint8_t data;
+    uint64_t time;
+} wire_byte;
+
+typedef struct {
+    std::string text;
+    //bytes it takes in rx buffer
+    size_t size;
+    uint64_t ready;
+} rx_line;
+
+static printer_sim_config sim;
+static bool sim_started = false;
+static std::deque<wire_byte> wire;
+static uint64_t wire_free = 0;
+static size_t rx_used = 0;
+static std::deque<rx_line> rx_lines;
+static std::string rx_text;
+static size_t rx_text_size = 0;
+static bool busy = false;
+static uint64_t busy_until = 0;
+static uint64_t free_since = 0;
+static std::string current;
+static int32_t current_number = -1;
+static uint64_t next_report = NEVER;
+static int32_t last_number = 0;
+//Repetier lines skipped after a resend request
+static uint8_t resend_skip = 0;
+static uint32_t lines_received = 0;
+static std::vector<std::string> lines_done;
+static uint32_t resend_requests = 0;
+static uint32_t corrupted_lines = 0;
+static uint32_t overflow_bytes = 0;
+static uint32_t wire_bytes = 0;
+//MeatPack unpacking
+static bool mp_active = false;
+static bool mp_signal = false;
+static bool mp_command_next = false;
+static uint8_t mp_literals = 0;
+static char mp_second = 0;
+
+static void answer (const char * line)
+{
+    host_printer_reply (line);
+    host_printer_reply ("\n");
+}
+
+static void answer (const std::string & line)
+{
+    answer (line.c_str());
+}
+
+static void add_char (uint8_t c, uint64_t time)
+{
+    if (c != '\n') {
+        rx_text += (char)c;
+        return;
+    }
+    rx_line line = {rx_text, rx_text_size, time};
+    lines_received++;
+    if (sim.corrupt_every && ((lines_received % sim.corrupt_every) == 0) && !line.text.empty()) {
+        line.text[line.text.size() / 2] ^= 0x02;
+        corrupted_lines++;
+    }
+    rx_lines.push_back (line);
+    rx_text.clear();
+    rx_text_size = 0;
+}
+
+//Marlin feature/meatpack.cpp
+static void meatpack_command (uint8_t command)
+{
+    switch (command) {
+    case 0xFB:
+        mp_active = true;
+        break;
+    case 0xFA:
+    case 0xF9:
+        mp_active = false;
+        mp_literals = 0;
+        mp_second = 0;
+        break;
+    default:
+        break;
+    }
+    answer (mp_active ? "[MP] PV01 ON ESP" : "[MP] PV01 OFF ESP");
+}
+
+static void unpack_byte (uint8_t c, uint64_t time)
+{
+    static const char unpacked[15] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', ' ', '\n', 'G', 'X'};
+    if (!mp_active) {
+        add_char (c, time);
+        return;
+    }
+    if (mp_literals > 0) {
+        add_char (c, time);
+        //packed second char comes after literal first one
+        if (mp_second) {
+            add_char (mp_second, time);
+            mp_second = 0;
+        }
+        mp_literals--;
+        return;
+    }
+    uint8_t low = c & 0x0F;
+    uint8_t high = c >> 4;
+    if (low == 0x0F) {
+        mp_literals++;
+        if (high == 0x0F) {
+            mp_literals++;
+        } else {
+            mp_second = unpacked[high];
+        }
+        return;
+    }
+    add_char (unpacked[low], time);
+    //other half of a byte starting by end of line is ignored
+    if (unpacked[low] != '\n') {
+        if (high == 0x0F) {
+            mp_literals++;
+        } else {
+            add_char (unpacked[high], time);
+        }
+    }
+}
+
+static void unpack (uint8_t c, uint64_t time)
+{
+    //two 0xFF then a command
+    if (mp_literals == 0) {
+        if (c == 0xFF) {
+            if (mp_signal) {
+                mp_command_next = true;
+                mp_signal = false;
+            } else {
+                mp_signal = true;
+            }
+            return;
+        }
+        if (mp_command_next) {
+            mp_command_next = false;
+            meatpack_command (c);
+            return;
+        }
+        if (mp_signal) {
+            mp_signal = false;
+            unpack_byte (0xFF, time);
+        }
+    }
+    unpack_byte (c, time);
+}
+
+static void receive (uint8_t c, uint64_t time)
+{
+    if (rx_used >= sim.rx_size) {
+        overflow_bytes++;
+        return;
+    }
+    rx_used++;
+    rx_text_size++;
+    if (sim.meatpack) {
+        unpack (c, time);
+    } else {
+        add_char (c, time);
+    }
+}
+
+static void request_resend (const char * error)
+{
+    int32_t number = last_number + 1;
+    resend_requests++;
+    switch (sim.firmware) {
+    case REPETIER:
+        resend_skip = 14;
+        answer ("Resend:" + std::to_string (number));
+        break;
+    case SMOOTHIEWARE:
+        answer ("rs N" + std::to_string (number));
+        break;
+    default:
+        answer (std::string ("Error:") + error + ", Last Line: " + std::to_string (last_number));
+        answer ("Resend: " + std::to_string (number));
+        break;
+    }
+    answer ("ok");
+}
+
+//value of letter in gcode, -1 if none
+static long gcode_value (const std::string & gcode, char letter)
+{
+    size_t p = gcode.find (letter);
+    if ((p == std::string::npos) || !isdigit (gcode[p + 1])) {
+        return -1;
+    }
+    return atol (gcode.c_str() + p + 1);
+}
+
+//check line number and checksum, gcode is what remains
+//return false if line is rejected
+static bool check_line (const std::string & line, std::string & gcode, int32_t & number)
+{
+    number = -1;
+    gcode = line;
+    if ((sim.firmware == GRBL) || line.empty() || (line[0] != 'N')) {
+        return true;
+    }
+    size_t star = line.rfind ('*');
+    size_t space = line.find (' ');
+    if (space == std::string::npos) {
+        space = line.size();
+    }
+    number = atol (line.c_str() + 1);
+    gcode = line.substr (space + 1, ((star == std::string::npos) ? line.size() : star) - space - 1);
+    //Repetier skips lines already seen and lines sent before resend request
+    if ((sim.firmware == REPETIER) && (number != (last_number + 1)) && (gcode.compare (0, 4, "M110") != 0)) {
+        if (((last_number - number) >= 0) && ((last_number - number) < 40)) {
+            answer ("skip " + std::to_string (number));
+            answer ("ok");
+            return false;
+        }
+        if (resend_skip > 0) {
+            resend_skip--;
+            answer ("skip " + std::to_string (number));
+            answer ("ok");
+            return false;
+        }
+    }
+    if (star == std::string::npos) {
+        request_resend ("No Checksum with line number");
+        return false;
+    }
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < star; i++) {
+        checksum ^= (uint8_t)line[i];
+    }
+    if (checksum != atoi (line.c_str() + star + 1)) {
+        request_resend ("checksum mismatch");
+        return false;
+    }
+    bool m110 = (gcode.compare (0, 4, "M110") == 0);
+    if (!m110 && (number != (last_number + 1))) {
+        request_resend ("Line Number is not Last Line Number+1");
+        return false;
+    }
+    last_number = number;
+    if (m110) {
+        long n = gcode_value (gcode.substr (4), 'N');
+        if (n >= 0) {
+            last_number = n;
+        }
+    }
+    return true;
+}
+
+static std::string temperature_report()
+{
+    return " T:210.0 /210.0 B:60.0 /60.0 @:64 B@:127";
+}
+
+//answers sent before ok
+static void command_answer (const std::string & gcode)
+{
+    if (sim.firmware == GRBL) {
+        if (gcode == "$I") {
+            answer ("[VER:1.1h.20190830:]");
+            answer ("[OPT:V,15,128]");
+        }
+        return;
+    }
+    if (gcode.compare (0, 4, "M105") == 0) {
+        answer ("ok" + temperature_report());
+        return;
+    }
+    if (gcode.compare (0, 4, "M114") == 0) {
+        answer ("X:10.00 Y:20.00 Z:0.30 E:0.00 Count X:800 Y:1600 Z:120");
+    }
+}
+
+static void take_line (uint64_t time)
+{
+    rx_line line = rx_lines.front();
+    rx_lines.pop_front();
+    rx_used -= line.size;
+    if (!line.text.empty() && (line.text[line.text.size() - 1] == '\r')) {
+        line.text.erase (line.text.size() - 1);
+    }
+    free_since = time;
+    if (line.text.empty()) {
+        return;
+    }
+    std::string gcode;
+    if (!check_line (line.text, gcode, current_number)) {
+        return;
+    }
+    current = gcode;
+    busy = true;
+    busy_until = time + sim.line_us;
+}
+
+static void finish_line (uint64_t time)
+{
+    busy = false;
+    free_since = time;
+    lines_done.push_back (current);
+    command_answer (current);
+    //M105 ok has temperatures
+    if ((sim.firmware != GRBL) && (current.compare (0, 4, "M105") == 0)) {
+        return;
+    }
+    if ((sim.firmware == REPETIER) && (current_number >= 0)) {
+        answer ("ok " + std::to_string (current_number));
+    } else if (sim.advanced_ok && (current_number >= 0)) {
+        answer ("ok N" + std::to_string (current_number) + " P15 B" + std::to_string (sim.rx_size - rx_used));
+    } else {
+        answer ("ok");
+    }
+}
+
+static void report()
+{
+    if (sim.firmware == GRBL) {
+        answer (busy ? "<Run|MPos:10.000,20.000,0.300|FS:1200,0>" : "<Idle|MPos:10.000,20.000,0.300|FS:0,0>");
+    } else {
+        answer (temperature_report());
+    }
+    next_report += sim.report_us;
+}
+
+//run printer up to now, events are done in time order
+static void sim_tick()
+{
+    for (;;) {
+        uint64_t t_wire = wire.empty() ? NEVER : wire.front().time;
+        uint64_t t_finish = busy ? busy_until : NEVER;
+        uint64_t t_take = NEVER;
+        if (!busy && !rx_lines.empty()) {
+            t_take = (rx_lines.front().ready > free_since) ? rx_lines.front().ready : free_since;
+        }
+        uint64_t t = t_wire;
+        if (t_finish < t) {
+            t = t_finish;
+        }
+        if (t_take < t) {
+            t = t_take;
+        }
+        if (next_report < t) {
+            t = next_report;
+        }
+        if ((t == NEVER) || (t > host_micros)) {
+            return;
+        }
+        if (t == t_finish) {
+            finish_line (t);
+        } else if (t == t_take) {
+            take_line (t);
+        } else if (t == t_wire) {
+            receive (wire.front().data, t);
+            wire.pop_front();
+        } else {
+            report();
+        }
+    }
+}
+
+static void sim_write (const uint8_t * data, size_t len)
+{
+    //a byte is 10 bits with start and stop bits
+    uint64_t byte_us = sim.baud ? (10000000ULL / sim.baud) : 0;
+    if (wire_free < host_micros) {
+        wire_free = host_micros;
+    }
+    for (size_t i = 0; i < len; i++) {
+        wire_free += byte_us;
+        wire_byte b = {data[i], wire_free};
+        wire.push_back (b);
+    }
+    wire_bytes += len;
+    sim_tick();
+}
+
+printer_sim_config PrinterSim::defaults (uint8_t firmware)
+{
+    printer_sim_config config;
+    config.firmware = firmware;
+    config.rx_size = (firmware == GRBL) ? 128 : 127;
+    config.baud = 115200;
+    config.line_us = 2000;
+    config.corrupt_every = 0;
+    config.report_us = 0;
+    config.advanced_ok = false;
+    config.meatpack = false;
+    return config;
+}
+
+void PrinterSim::begin (const printer_sim_config & config)
+{
+    sim = config;
+    wire.clear();
+    wire_free = host_micros;
+    rx_used = 0;
+    rx_lines.clear();
+    rx_text.clear();
+    rx_text_size = 0;
+    busy = false;
+    free_since = host_micros;
+    last_number = 0;
+    resend_skip = 0;
+    lines_received = 0;
+    lines_done.clear();
+    resend_requests = 0;
+    corrupted_lines = 0;
+    overflow_bytes = 0;
+    wire_bytes = 0;
+    mp_active = false;
+    mp_signal = false;
+    mp_command_next = false;
+    mp_literals = 0;
+    mp_second = 0;
+    next_report = sim.report_us ? (host_micros + sim.report_us) : NEVER;
+    host_printer_hook = sim_write;
+    host_tick = sim_tick;
+    sim_started = true;
+}
+
+void PrinterSim::end()
+{
+    if (sim_started) {
+        host_printer_hook = NULL;
+        host_tick = NULL;
+        sim_started = false;
+    }
+}
+
+void PrinterSim::say (const char * line)
+{
+    answer (line);
+}
+
+const std::vector<std::string> & PrinterSim::done()
+{
+    return lines_done;
+}
+
+int32_t PrinterSim::lastLineNumber()
+{
+    return last_number;
+}
+
+uint32_t PrinterSim::resendRequests()
+{
+    return resend_requests;
+}
+
+uint32_t PrinterSim::corrupted()
+{
+    return corrupted_lines;
+}
+
+uint32_t PrinterSim::overflows()
+{
+    return overflow_bytes;
+}
+
+uint32_t PrinterSim::wireBytes()
+{
+    return wire_bytes;
+}
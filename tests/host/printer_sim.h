@@ -0,0 +1,58 @@
+/*
+  printer_sim.h - scripted fake printer for host tests
+
+  Plays printer side of the fake serial port of esp3d_stubs: bytes sent
+  by ESP go through the wire at baud rate into an rx buffer of printer
+  size (bytes beyond it are lost), lines are taken one at a time and are
+  done after line_us, then acknowledged the way firmware does.
+  Each rejected line (bad checksum or line number) is answered by a
+  resend request then ok, as Marlin does. Some received lines can be
+  corrupted on purpose and printer can report temperatures by itself.
+  Time is the simulated clock, printer runs each time it moves.
+*/
+
+#ifndef _PRINTER_SIM_H
+#define _PRINTER_SIM_H
+#include "esp3d_stubs.h"
+#include <string>
+#include <vector>
+
+typedef struct {
+    //MARLIN, REPETIER, SMOOTHIEWARE or GRBL
+    uint8_t firmware;
+    //printer serial rx buffer
+    uint16_t rx_size;
+    //0 means bytes are in rx buffer at once
+    uint32_t baud;
+    //time to do a line once taken from rx buffer
+    uint32_t line_us;
+    //one received line in corrupt_every gets a wrong bit, 0 means never
+    uint32_t corrupt_every;
+    //temperature (Grbl: status) auto report period, 0 means none
+    uint32_t report_us;
+    //Marlin ADVANCED_OK: ok N<line> P<queue> B<rx room>
+    bool advanced_ok;
+    //Marlin MEATPACK, packed data are unpacked once printer is asked to
+    bool meatpack;
+} printer_sim_config;
+
+class PrinterSim
+{
+public:
+    static printer_sim_config defaults (uint8_t firmware);
+    static void begin (const printer_sim_config & config);
+    static void end();
+    //printer sends a line by itself, like start after a reset
+    static void say (const char * line);
+    //gcode done in order, without line number and checksum
+    static const std::vector<std::string> & done();
+    static int32_t lastLineNumber();
+    static uint32_t resendRequests();
+    static uint32_t corrupted();
+    //bytes lost because rx buffer was full
+    static uint32_t overflows();
+    //bytes received on the wire
+    static uint32_t wireBytes();
+};
+
+#endif //_PRINTER_SIM_H
@@ -0,0 +1,471 @@
+/*
+  Arduino.h - minimal Arduino API to build ESP3D units on host
+
+  Only what host built units use is here, it is not an Arduino core.
+  Time is simulated: it only moves when delay() / yield() are called
+  or when a test moves it.
+*/
+
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef unsigned int uint;
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define memcpy_P memcpy
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+
+#define HEX 16
+#define DEC 10
+
+inline bool isDigit(int c)
+{
+    return isdigit(c);
+}
+
+inline bool isPrintable(int c)
+{
+    return isprint(c);
+}
+
+//simulated clock in us, loop passes cost HOST_LOOP_US
+#define HOST_LOOP_US 20
+extern uint64_t host_micros;
+//called each time clock moves, a fake device can run then
+extern void (*host_tick)();
+inline void host_advance(uint64_t us)
+{
+    host_micros += us;
+    if (host_tick) {
+        host_tick();
+    }
+}
+inline unsigned long micros()
+{
+    return (unsigned long)host_micros;
+}
+inline unsigned long millis()
+{
+    return (unsigned long)(host_micros / 1000);
+}
+inline void delay(unsigned long ms)
+{
+    host_advance(ms ? (uint64_t)ms * 1000 : HOST_LOOP_US);
+}
+inline void yield()
+{
+    host_advance(HOST_LOOP_US);
+}
+
+class String
+{
+public:
+    String(const char * s = "") : _s(s ? s : "") {}
+    String(const std::string & s) : _s(s) {}
+    String(const __FlashStringHelper * s) : _s((const char *)s) {}
+    String(char c) : _s(1, c) {}
+    String(int value, unsigned char base = DEC)
+    {
+        fromLong(value, base);
+    }
+    String(unsigned int value, unsigned char base = DEC)
+    {
+        fromLong(value, base);
+    }
+    String(long value, unsigned char base = DEC)
+    {
+        fromLong(value, base);
+    }
+    String(unsigned long value, unsigned char base = DEC)
+    {
+        fromLong(value, base);
+    }
+    String(unsigned char value, unsigned char base = DEC)
+    {
+        fromLong(value, base);
+    }
+    String(float value, unsigned char decimals = 2)
+    {
+        fromDouble(value, decimals);
+    }
+    String(double value, unsigned char decimals = 2)
+    {
+        fromDouble(value, decimals);
+    }
+    const char * c_str() const
+    {
+        return _s.c_str();
+    }
+    unsigned int length() const
+    {
+        return _s.size();
+    }
+    void reserve(unsigned int size)
+    {
+        _s.reserve(size);
+    }
+    char charAt(unsigned int index) const
+    {
+        return (index < _s.size()) ? _s[index] : 0;
+    }
+    char operator[](unsigned int index) const
+    {
+        return charAt(index);
+    }
+    char & operator[](unsigned int index)
+    {
+        return _s[index];
+    }
+    String & operator=(const char * s)
+    {
+        _s = s ? s : "";
+        return *this;
+    }
+    String & operator+=(const String & s)
+    {
+        _s += s._s;
+        return *this;
+    }
+    String & operator+=(const char * s)
+    {
+        _s += s;
+        return *this;
+    }
+    String & operator+=(char c)
+    {
+        _s += c;
+        return *this;
+    }
+    String & operator+=(const __FlashStringHelper * s)
+    {
+        _s += (const char *)s;
+        return *this;
+    }
+    bool concat(const String & s)
+    {
+        _s += s._s;
+        return true;
+    }
+    bool concat(char c)
+    {
+        _s += c;
+        return true;
+    }
+    bool operator==(const String & s) const
+    {
+        return _s == s._s;
+    }
+    bool operator==(const char * s) const
+    {
+        return _s == s;
+    }
+    bool operator!=(const String & s) const
+    {
+        return _s != s._s;
+    }
+    bool operator!=(const char * s) const
+    {
+        return _s != s;
+    }
+    bool equals(const String & s) const
+    {
+        return _s == s._s;
+    }
+    bool equalsIgnoreCase(const String & s) const
+    {
+        return strcasecmp(_s.c_str(), s._s.c_str()) == 0;
+    }
+    bool startsWith(const String & s) const
+    {
+        return _s.compare(0, s._s.size(), s._s) == 0;
+    }
+    bool endsWith(const String & s) const
+    {
+        return (_s.size() >= s._s.size()) && (_s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0);
+    }
+    int indexOf(char c, unsigned int from = 0) const
+    {
+        size_t p = _s.find(c, from);
+        return (p == std::string::npos) ? -1 : (int)p;
+    }
+    int indexOf(const String & s, unsigned int from = 0) const
+    {
+        size_t p = _s.find(s._s, from);
+        return (p == std::string::npos) ? -1 : (int)p;
+    }
+    int lastIndexOf(char c) const
+    {
+        size_t p = _s.rfind(c);
+        return (p == std::string::npos) ? -1 : (int)p;
+    }
+    String substring(unsigned int from) const
+    {
+        return (from < _s.size()) ? String(_s.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (to > _s.size()) {
+            to = _s.size();
+        }
+        return (from < to) ? String(_s.substr(from, to - from)) : String();
+    }
+    void replace(const String & find, const String & by)
+    {
+        if (find._s.empty()) {
+            return;
+        }
+        size_t p = 0;
+        while ((p = _s.find(find._s, p)) != std::string::npos) {
+            _s.replace(p, find._s.size(), by._s);
+            p += by._s.size();
+        }
+    }
+    void remove(unsigned int index, unsigned int count = (unsigned int) -1)
+    {
+        if (index < _s.size()) {
+            _s.erase(index, count);
+        }
+    }
+    void trim()
+    {
+        size_t b = _s.find_first_not_of(" \t\r\n");
+        size_t e = _s.find_last_not_of(" \t\r\n");
+        _s = (b == std::string::npos) ? std::string() : _s.substr(b, e - b + 1);
+    }
+    void toUpperCase()
+    {
+        for (size_t i = 0; i < _s.size(); i++) {
+            _s[i] = toupper(_s[i]);
+        }
+    }
+    void toLowerCase()
+    {
+        for (size_t i = 0; i < _s.size(); i++) {
+            _s[i] = tolower(_s[i]);
+        }
+    }
+    long toInt() const
+    {
+        return atol(_s.c_str());
+    }
+    float toFloat() const
+    {
+        return atof(_s.c_str());
+    }
+private:
+    std::string _s;
+    void fromLong(long value, unsigned char base)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), (base == HEX) ? "%lx" : "%ld", value);
+        _s = buf;
+    }
+    void fromLong(unsigned long value, unsigned char base)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), (base == HEX) ? "%lx" : "%lu", value);
+        _s = buf;
+    }
+    void fromLong(int value, unsigned char base)
+    {
+        fromLong((long)value, base);
+    }
+    void fromLong(unsigned int value, unsigned char base)
+    {
+        fromLong((unsigned long)value, base);
+    }
+    void fromLong(unsigned char value, unsigned char base)
+    {
+        fromLong((unsigned long)value, base);
+    }
+    void fromDouble(double value, unsigned char decimals)
+    {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+        _s = buf;
+    }
+};
+
+inline String operator+(const String & a, const String & b)
+{
+    String s(a);
+    s += b;
+    return s;
+}
+inline String operator+(const String & a, const char * b)
+{
+    String s(a);
+    s += b;
+    return s;
+}
+inline String operator+(const char * a, const String & b)
+{
+    String s(a);
+    s += b;
+    return s;
+}
+inline String operator+(const String & a, char b)
+{
+    String s(a);
+    s += b;
+    return s;
+}
+inline String operator+(const String & a, const __FlashStringHelper * b)
+{
+    String s(a);
+    s += b;
+    return s;
+}
+
+//printer side of UART is a fake device, see esp3d_stubs.h
+class HardwareSerial
+{
+public:
+    void begin(unsigned long baud, uint32_t config = 0, int8_t rx = -1, int8_t tx = -1, bool invert = false)
+    {
+        (void)config;
+        (void)rx;
+        (void)tx;
+        (void)invert;
+        _baud = baud;
+    }
+    void end()
+    {
+        _baud = 0;
+    }
+    uint32_t baudRate()
+    {
+        return _baud;
+    }
+    size_t setRxBufferSize(size_t size)
+    {
+        return size;
+    }
+    void setDebugOutput(bool) {}
+    void swap() {}
+    int available()
+    {
+        return 0;
+    }
+    size_t write(const uint8_t * data, size_t len)
+    {
+        (void)data;
+        return len;
+    }
+    size_t write(uint8_t d)
+    {
+        (void)d;
+        return 1;
+    }
+    size_t print(const char * s)
+    {
+        return strlen(s);
+    }
+    size_t print(const String & s)
+    {
+        return s.length();
+    }
+    size_t println(const char * s = "")
+    {
+        return strlen(s) + 2;
+    }
+    size_t println(const String & s)
+    {
+        return s.length() + 2;
+    }
+    void flush() {}
+private:
+    unsigned long _baud = 0;
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+#define SERIAL_8N1 0x800001c
+
+class IPAddress
+{
+public:
+    IPAddress(uint32_t address = 0) : _address(address) {}
+    IPAddress(const uint8_t * address) : IPAddress(address[0], address[1], address[2], address[3]) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _address(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    operator uint32_t() const
+    {
+        return _address;
+    }
+    uint8_t operator[](int index) const
+    {
+        return (_address >> (8 * index)) & 0xFF;
+    }
+    String toString() const
+    {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+        return String(buf);
+    }
+private:
+    uint32_t _address;
+};
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap()
+    {
+        return 100000;
+    }
+    uint32_t getCpuFreqMHz()
+    {
+        return 240;
+    }
+    uint64_t getEfuseMac()
+    {
+        return 0x0000AABBCCDDEEFFULL;
+    }
+    uint32_t getFlashChipSize()
+    {
+        return 4194304;
+    }
+    uint32_t getSketchSize()
+    {
+        return 1048576;
+    }
+    const char * getSdkVersion()
+    {
+        return "host";
+    }
+    void restart() {}
+};
+extern EspClass ESP;
+
+inline float temperatureRead()
+{
+    return 40.0;
+}
+
+#endif //_HOST_ARDUINO_H
@@ -0,0 +1,37 @@
+/*
+  EEPROM.h - host emulated EEPROM
+
+  Like ESP cores: begin() copies flash to RAM image, commit() writes
+  whole image back (one sector erase). Tests read host_flash and the
+  counters, and can cut a commit to emulate a power loss.
+*/
+
+#ifndef _HOST_EEPROM_H
+#define _HOST_EEPROM_H
+#include <stdint.h>
+#include <stddef.h>
+
+#define HOST_FLASH_SIZE 4096
+extern uint8_t host_flash[HOST_FLASH_SIZE];
+//number of begin() flash reads and commit() sector erases
+extern uint32_t host_flash_reads;
+extern uint32_t host_flash_erases;
+//if >= 0 next commit stops after that many bytes, as on power loss
+extern int host_flash_cut;
+
+class EEPROMClass
+{
+public:
+    void begin(size_t size);
+    uint8_t read(int address);
+    void write(int address, uint8_t value);
+    bool commit();
+    void end();
+private:
+    uint8_t * _data = NULL;
+    size_t _size = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif //_HOST_EEPROM_H
@@ -0,0 +1,8 @@
+/*
+  ESPmDNS.h - host mDNS stand-in
+*/
+
+#ifndef _HOST_ESPMDNS_H
+#define _HOST_ESPMDNS_H
+class MDNSResponder {};
+#endif //_HOST_ESPMDNS_H
@@ -0,0 +1,65 @@
+/*
+  FS.h - host file system stand-in, files are not stored
+*/
+
+#ifndef _HOST_FS_H
+#define _HOST_FS_H
+#include <Arduino.h>
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+namespace fs
+{
+class File
+{
+public:
+    size_t write(const uint8_t * data, size_t len)
+    {
+        (void)data;
+        return len;
+    }
+    size_t size()
+    {
+        return 0;
+    }
+    void close() {}
+    operator bool() const
+    {
+        return false;
+    }
+};
+
+class FS
+{
+public:
+    bool begin()
+    {
+        return true;
+    }
+    void end() {}
+    size_t totalBytes()
+    {
+        return 1441792;
+    }
+    size_t usedBytes()
+    {
+        return 0;
+    }
+    File open(const String & path, const char * mode = FILE_READ)
+    {
+        (void)path;
+        (void)mode;
+        return File();
+    }
+    bool exists(const String & path)
+    {
+        (void)path;
+        return false;
+    }
+    bool remove(const String & path)
+    {
+        (void)path;
+        return true;
+    }
+};
+}
+#endif //_HOST_FS_H
@@ -0,0 +1,4 @@
+/*
+  IPAddress.h - host shim, class is in Arduino.h
+*/
+#include <Arduino.h>
@@ -0,0 +1,9 @@
+/*
+  SPIFFS.h - host SPIFFS stand-in
+*/
+
+#ifndef _HOST_SPIFFS_H
+#define _HOST_SPIFFS_H
+#include "FS.h"
+extern fs::FS SPIFFS;
+#endif //_HOST_SPIFFS_H
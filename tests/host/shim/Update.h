@@ -0,0 +1,3 @@
+/*
+  Update.h - host shim, nothing is used
+*/
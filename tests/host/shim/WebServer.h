@@ -0,0 +1,15 @@
+/*
+  WebServer.h - host shim, web server is not built on host
+*/
+
+#ifndef _HOST_WEBSERVER_H
+#define _HOST_WEBSERVER_H
+class WebServer
+{
+public:
+    WebServer(int port = 80)
+    {
+        (void)port;
+    }
+};
+#endif //_HOST_WEBSERVER_H
@@ -0,0 +1,109 @@
+/*
+  WiFi.h - host wifi stand-in
+
+  Wifi is always an access point with default settings and no station.
+*/
+
+#ifndef _HOST_WIFI_H
+#define _HOST_WIFI_H
+#include <Arduino.h>
+#include "esp_wifi.h"
+#include "WiFiClient.h"
+#include "WiFiServer.h"
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class WiFiClass
+{
+public:
+    wifi_mode_t getMode()
+    {
+        return _mode;
+    }
+    bool mode(wifi_mode_t m)
+    {
+        _mode = m;
+        return true;
+    }
+    wl_status_t status()
+    {
+        return WL_DISCONNECTED;
+    }
+    bool isConnected()
+    {
+        return false;
+    }
+    uint8_t * macAddress(uint8_t * mac)
+    {
+        memset(mac, 0x11, 6);
+        return mac;
+    }
+    String macAddress()
+    {
+        return String("11:11:11:11:11:11");
+    }
+    uint8_t * softAPmacAddress(uint8_t * mac)
+    {
+        memset(mac, 0x22, 6);
+        return mac;
+    }
+    String softAPmacAddress()
+    {
+        return String("22:22:22:22:22:22");
+    }
+    IPAddress localIP()
+    {
+        return IPAddress();
+    }
+    IPAddress softAPIP()
+    {
+        return IPAddress(192, 168, 0, 1);
+    }
+    IPAddress subnetMask()
+    {
+        return IPAddress(255, 255, 255, 0);
+    }
+    IPAddress gatewayIP()
+    {
+        return IPAddress();
+    }
+    IPAddress dnsIP(uint8_t n = 0)
+    {
+        (void)n;
+        return IPAddress();
+    }
+    const char * getHostname()
+    {
+        return "esp3d";
+    }
+    String SSID()
+    {
+        return String();
+    }
+    int32_t RSSI()
+    {
+        return 0;
+    }
+    int32_t channel()
+    {
+        return 11;
+    }
+private:
+    wifi_mode_t _mode = WIFI_AP;
+};
+extern WiFiClass WiFi;
+#endif //_HOST_WIFI_H
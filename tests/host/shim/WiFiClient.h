@@ -0,0 +1,44 @@
+/*
+  WiFiClient.h - host TCP client stand-in, never connected
+*/
+
+#ifndef _HOST_WIFICLIENT_H
+#define _HOST_WIFICLIENT_H
+#include <Arduino.h>
+class WiFiClient
+{
+public:
+    bool connected()
+    {
+        return false;
+    }
+    operator bool()
+    {
+        return false;
+    }
+    int available()
+    {
+        return 0;
+    }
+    int read(uint8_t * data, size_t len)
+    {
+        (void)data;
+        (void)len;
+        return 0;
+    }
+    size_t write(const uint8_t * data, size_t len)
+    {
+        (void)data;
+        return len;
+    }
+    size_t print(const char * data)
+    {
+        return strlen(data);
+    }
+    IPAddress remoteIP()
+    {
+        return IPAddress();
+    }
+    void stop() {}
+};
+#endif //_HOST_WIFICLIENT_H
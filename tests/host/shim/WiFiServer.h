@@ -0,0 +1,25 @@
+/*
+  WiFiServer.h - host TCP server stand-in, no client ever comes
+*/
+
+#ifndef _HOST_WIFISERVER_H
+#define _HOST_WIFISERVER_H
+#include "WiFiClient.h"
+class WiFiServer
+{
+public:
+    WiFiServer(uint16_t port = 80)
+    {
+        (void)port;
+    }
+    void begin() {}
+    bool hasClient()
+    {
+        return false;
+    }
+    WiFiClient available()
+    {
+        return WiFiClient();
+    }
+};
+#endif //_HOST_WIFISERVER_H
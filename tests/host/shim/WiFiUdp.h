@@ -0,0 +1,3 @@
+/*
+  WiFiUdp.h - host shim, nothing is used
+*/
@@ -0,0 +1,244 @@
+/*
+  esp3d_stubs.cpp - host implementation of hardware and network modules
+*/
+
+#include "esp3d_stubs.h"
+#include <EEPROM.h>
+#include <SPIFFS.h>
+#include <esp_ota_ops.h>
+#include "wificonf.h"
+#include "webinterface.h"
+#include "notifications_service.h"
+
+uint64_t host_micros = 0;
+void (*host_tick)() = NULL;
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+EspClass ESP;
+WiFiClass WiFi;
+fs::FS SPIFFS;
+
+//flash erased state
+uint8_t host_flash[HOST_FLASH_SIZE];
+uint32_t host_flash_reads = 0;
+uint32_t host_flash_erases = 0;
+int host_flash_cut = -1;
+EEPROMClass EEPROM;
+
+//flash comes erased
+static struct host_flash_init {
+    host_flash_init()
+    {
+        memset(host_flash, 0xFF, HOST_FLASH_SIZE);
+    }
+} host_flash_init;
+
+void EEPROMClass::begin(size_t size)
+{
+    if (size > HOST_FLASH_SIZE) {
+        size = HOST_FLASH_SIZE;
+    }
+    delete [] _data;
+    _data = new uint8_t[size];
+    _size = size;
+    memcpy(_data, host_flash, size);
+    host_flash_reads++;
+}
+
+uint8_t EEPROMClass::read(int address)
+{
+    if ((address < 0) || ((size_t)address >= _size)) {
+        return 0;
+    }
+    return _data[address];
+}
+
+void EEPROMClass::write(int address, uint8_t value)
+{
+    if ((address < 0) || ((size_t)address >= _size)) {
+        return;
+    }
+    _data[address] = value;
+}
+
+bool EEPROMClass::commit()
+{
+    if (!_data) {
+        return false;
+    }
+    //sector is erased then written from start
+    host_flash_erases++;
+    memset(host_flash, 0xFF, _size);
+    size_t n = _size;
+    if (host_flash_cut >= 0) {
+        n = ((size_t)host_flash_cut < _size) ? host_flash_cut : _size;
+        host_flash_cut = -1;
+    }
+    memcpy(host_flash, _data, n);
+    return n == _size;
+}
+
+void EEPROMClass::end()
+{
+    delete [] _data;
+    _data = NULL;
+    _size = 0;
+}
+
+static esp_partition_t host_partition = {1310720};
+const esp_partition_t * esp_ota_get_running_partition()
+{
+    return &host_partition;
+}
+const esp_partition_t * esp_ota_get_next_update_partition(const esp_partition_t * start)
+{
+    (void)start;
+    return &host_partition;
+}
+
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t * type)
+{
+    *type = WIFI_PS_NONE;
+    return 0;
+}
+esp_err_t esp_wifi_get_protocol(wifi_interface_t ifx, uint8_t * protocol)
+{
+    (void)ifx;
+    *protocol = WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N;
+    return 0;
+}
+esp_err_t esp_wifi_set_protocol(wifi_interface_t ifx, uint8_t protocol)
+{
+    (void)ifx;
+    (void)protocol;
+    return 0;
+}
+esp_err_t esp_wifi_get_config(wifi_interface_t ifx, wifi_config_t * conf)
+{
+    (void)ifx;
+    memset(conf, 0, sizeof(wifi_config_t));
+    strcpy((char *)conf->ap.ssid, "ESP3D");
+    conf->ap.channel = 11;
+    conf->ap.authmode = WIFI_AUTH_WPA_PSK;
+    conf->ap.max_connection = 1;
+    return 0;
+}
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t * sta)
+{
+    memset(sta, 0, sizeof(wifi_sta_list_t));
+    return 0;
+}
+esp_err_t tcpip_adapter_dhcpc_get_status(tcpip_adapter_if_t tcpip_if, tcpip_adapter_dhcp_status_t * status)
+{
+    (void)tcpip_if;
+    *status = TCPIP_ADAPTER_DHCP_STOPPED;
+    return 0;
+}
+esp_err_t tcpip_adapter_dhcps_get_status(tcpip_adapter_if_t tcpip_if, tcpip_adapter_dhcp_status_t * status)
+{
+    (void)tcpip_if;
+    *status = TCPIP_ADAPTER_DHCP_STARTED;
+    return 0;
+}
+esp_err_t tcpip_adapter_get_ip_info(tcpip_adapter_if_t tcpip_if, tcpip_adapter_ip_info_t * ip_info)
+{
+    memset(ip_info, 0, sizeof(tcpip_adapter_ip_info_t));
+    if (tcpip_if == TCPIP_ADAPTER_IF_AP) {
+        ip_info->ip.addr = IPAddress(192, 168, 0, 1);
+        ip_info->netmask.addr = IPAddress(255, 255, 255, 0);
+        ip_info->gw.addr = IPAddress(192, 168, 0, 1);
+    }
+    return 0;
+}
+esp_err_t tcpip_adapter_get_sta_list(const wifi_sta_list_t * wifi_sta_list, tcpip_adapter_sta_list_t * tcpip_sta_list)
+{
+    (void)wifi_sta_list;
+    memset(tcpip_sta_list, 0, sizeof(tcpip_adapter_sta_list_t));
+    return 0;
+}
+
+WEBINTERFACE_CLASS::WEBINTERFACE_CLASS (int port) : web_server (port)
+{
+    restartmodule = false;
+    blockserial = false;
+    _upload_status = UPLOAD_STATUS_NONE;
+    _head = NULL;
+    _nb_ip = 0;
+}
+WEBINTERFACE_CLASS::~WEBINTERFACE_CLASS() {}
+level_authenticate_type WEBINTERFACE_CLASS::is_authenticated()
+{
+    return LEVEL_ADMIN;
+}
+static WEBINTERFACE_CLASS host_web_interface;
+WEBINTERFACE_CLASS * web_interface = &host_web_interface;
+
+WIFI_CONFIG::WIFI_CONFIG()
+{
+    iweb_port = DEFAULT_WEB_PORT;
+    idata_port = DEFAULT_DATA_PORT;
+    baud_rate = DEFAULT_BAUD_RATE;
+    sleep_mode = DEFAULT_SLEEP_MODE;
+    WiFi_on = true;
+    _hostname[0] = 0;
+}
+int32_t WIFI_CONFIG::getSignal (int32_t RSSI)
+{
+    if (RSSI <= -100) {
+        return 0;
+    }
+    if (RSSI >= -50) {
+        return 100;
+    }
+    return (2 * (RSSI + 100) );
+}
+const char * WIFI_CONFIG::get_default_hostname()
+{
+    return "esp3d";
+}
+WIFI_CONFIG wifi_config;
+
+NotificationsService::NotificationsService()
+{
+    _started = false;
+    _notificationType = 0;
+    _autonotification = false;
+    _port = 0;
+}
+NotificationsService::~NotificationsService() {}
+bool NotificationsService::started()
+{
+    return _started;
+}
+const char * NotificationsService::getTypeString()
+{
+    return "none";
+}
+NotificationsService notificationsservice;
+
+void host_reset()
+{
+    memset(host_flash, 0xFF, HOST_FLASH_SIZE);
+    host_flash_reads = 0;
+    host_flash_erases = 0;
+    host_flash_cut = -1;
+    host_reboot();
+    host_micros = 0;
+    host_tick = NULL;
+    host_printer_output.clear();
+    host_printer_hook = NULL;
+    host_printer_room = (size_t) -1;
+    host_printer_input.clear();
+    host_pipe_output.clear();
+    host_tcp_client = false;
+    host_line_busy = false;
+    web_interface->blockserial = false;
+}
+
+void host_reboot()
+{
+    //settings stay cached in RAM once loaded, reload it as on boot
+    EEPROM.begin (EEPROM_SIZE);
+}
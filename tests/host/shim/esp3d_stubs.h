@@ -0,0 +1,40 @@
+/*
+  esp3d_stubs.h - host side of ESP3D modules which need hardware
+
+  Units are built from esp3d sources with real headers, modules tied to
+  hardware (serial, wifi, web server) get a small host implementation.
+  Printer serial is a fake port: what is sent is kept and passed to a
+  hook, what printer answers is queued by tests or by a fake printer.
+*/
+
+#ifndef _ESP3D_STUBS_H
+#define _ESP3D_STUBS_H
+#include <Arduino.h>
+#include <string>
+#include "config.h"
+
+//all bytes sent to printer
+extern std::string host_printer_output;
+//called for each write to printer, a fake printer parses it
+extern void (*host_printer_hook)(const uint8_t * data, size_t len);
+//room in printer serial tx, writes beyond it are refused
+extern size_t host_printer_room;
+//what printer sent and ESP did not read yet
+extern std::string host_printer_input;
+inline void host_printer_reply(const char * data)
+{
+    host_printer_input += data;
+}
+
+//all bytes sent to pipes other than printer
+extern std::string host_pipe_output;
+extern bool host_tcp_client;
+//printer line owned by a tcp/websocket client in middle of a line
+extern bool host_line_busy;
+
+//blank flash, clock at 0, printer port empty
+void host_reset();
+//power cycle: settings are loaded again from flash
+void host_reboot();
+
+#endif //_ESP3D_STUBS_H
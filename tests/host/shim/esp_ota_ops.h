@@ -0,0 +1,13 @@
+/*
+  esp_ota_ops.h - host shim of ESP-IDF OTA partitions
+*/
+
+#ifndef _HOST_ESP_OTA_OPS_H
+#define _HOST_ESP_OTA_OPS_H
+#include <stdint.h>
+typedef struct {
+    uint32_t size;
+} esp_partition_t;
+const esp_partition_t * esp_ota_get_running_partition();
+const esp_partition_t * esp_ota_get_next_update_partition(const esp_partition_t * start);
+#endif //_HOST_ESP_OTA_OPS_H
@@ -0,0 +1,100 @@
+/*
+  esp_wifi.h - host shim of ESP-IDF wifi and tcpip adapter calls
+
+  Wifi is always an access point with default settings and no station.
+*/
+
+#ifndef _HOST_ESP_WIFI_H
+#define _HOST_ESP_WIFI_H
+#include <stdint.h>
+typedef int esp_err_t;
+
+typedef enum {
+    WIFI_PS_NONE,
+    WIFI_PS_MIN_MODEM,
+    WIFI_PS_MAX_MODEM,
+} wifi_ps_type_t;
+
+typedef enum {
+    WIFI_IF_STA = 0,
+    WIFI_IF_AP,
+} wifi_interface_t;
+
+#define WIFI_PROTOCOL_11B 1
+#define WIFI_PROTOCOL_11G 2
+#define WIFI_PROTOCOL_11N 4
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+} wifi_auth_mode_t;
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    uint8_t ssid_len;
+    uint8_t channel;
+    wifi_auth_mode_t authmode;
+    uint8_t ssid_hidden;
+    uint8_t max_connection;
+    uint16_t beacon_interval;
+} wifi_ap_config_t;
+
+typedef union {
+    wifi_ap_config_t ap;
+} wifi_config_t;
+
+typedef struct {
+    uint8_t mac[6];
+} wifi_sta_info_t;
+
+typedef struct {
+    wifi_sta_info_t sta[10];
+    int num;
+} wifi_sta_list_t;
+
+typedef struct {
+    uint32_t addr;
+} ip4_addr_t;
+
+typedef struct {
+    ip4_addr_t ip;
+    ip4_addr_t netmask;
+    ip4_addr_t gw;
+} tcpip_adapter_ip_info_t;
+
+typedef struct {
+    uint8_t mac[6];
+    ip4_addr_t ip;
+} tcpip_adapter_sta_info_t;
+
+typedef struct {
+    tcpip_adapter_sta_info_t sta[10];
+    int num;
+} tcpip_adapter_sta_list_t;
+
+typedef enum {
+    TCPIP_ADAPTER_IF_STA = 0,
+    TCPIP_ADAPTER_IF_AP,
+} tcpip_adapter_if_t;
+
+typedef enum {
+    TCPIP_ADAPTER_DHCP_INIT = 0,
+    TCPIP_ADAPTER_DHCP_STARTED,
+    TCPIP_ADAPTER_DHCP_STOPPED,
+} tcpip_adapter_dhcp_status_t;
+
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t * type);
+esp_err_t esp_wifi_get_protocol(wifi_interface_t ifx, uint8_t * protocol);
+esp_err_t esp_wifi_set_protocol(wifi_interface_t ifx, uint8_t protocol);
+esp_err_t esp_wifi_get_config(wifi_interface_t ifx, wifi_config_t * conf);
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t * sta);
+esp_err_t tcpip_adapter_dhcpc_get_status(tcpip_adapter_if_t tcpip_if, tcpip_adapter_dhcp_status_t * status);
+esp_err_t tcpip_adapter_dhcps_get_status(tcpip_adapter_if_t tcpip_if, tcpip_adapter_dhcp_status_t * status);
+esp_err_t tcpip_adapter_get_ip_info(tcpip_adapter_if_t tcpip_if, tcpip_adapter_ip_info_t * ip_info);
+esp_err_t tcpip_adapter_get_sta_list(const wifi_sta_list_t * wifi_sta_list, tcpip_adapter_sta_list_t * tcpip_sta_list);
+#endif //_HOST_ESP_WIFI_H
@@ -0,0 +1,177 @@
+/*
+  host_espcom.cpp - ESPCOM over a fake printer port
+
+  Printer pipe writes go to host_printer_output and the fake printer hook,
+  packed when MeatPack is active, printer answers are read from
+  host_printer_input. Web pipe fills response buffer, other pipes are kept
+  in host_pipe_output.
+*/
+
+#include "esp3d_stubs.h"
+#include "espcom.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
+
+std::string host_printer_output;
+void (*host_printer_hook)(const uint8_t * data, size_t len) = NULL;
+size_t host_printer_room = (size_t) -1;
+std::string host_printer_input;
+std::string host_pipe_output;
+bool host_tcp_client = false;
+bool host_line_busy = false;
+
+uint8_t ESPCOM::current_socket_id = 0;
+bool ESPCOM::block_2_printer = false;
+
+size_t ESPCOM::write(tpipe output, uint8_t d)
+{
+    return write(output, &d, 1);
+}
+
+static void printer_write(const uint8_t * data, size_t len)
+{
+    host_printer_output.append((const char *)data, len);
+    if (host_printer_hook) {
+        host_printer_hook(data, len);
+    }
+}
+
+#ifdef MEATPACK_FEATURE
+//same as firmware: all packed bytes are taken
+static size_t send_packed(const uint8_t * data, size_t len)
+{
+    uint8_t packed[64];
+    size_t done = 0;
+    while (done < len) {
+        size_t used;
+        size_t size = MeatPack::encode(&data[done], len - done, packed, sizeof(packed), used);
+        done += used;
+        printer_write(packed, size);
+    }
+    return len;
+}
+#endif
+
+size_t ESPCOM::write(tpipe output, const uint8_t * data, size_t len)
+{
+    if (DEFAULT_PRINTER_PIPE != output) {
+        host_pipe_output.append((const char *)data, len);
+        return len;
+    }
+#ifdef MEATPACK_FEATURE
+    if (MeatPack::active()) {
+        return send_packed(data, len);
+    }
+#endif
+    if (len > host_printer_room) {
+        len = host_printer_room;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    printer_write(data, len);
+    return len;
+}
+
+size_t ESPCOM::availableForWrite(tpipe output)
+{
+    if (DEFAULT_PRINTER_PIPE != output) {
+        return 0;
+    }
+    return host_printer_room;
+}
+
+long ESPCOM::readBytes (tpipe output, uint8_t * sbuf, size_t len)
+{
+    if (DEFAULT_PRINTER_PIPE != output) {
+        return 0;
+    }
+    if (len > host_printer_input.size()) {
+        len = host_printer_input.size();
+    }
+    memcpy(sbuf, host_printer_input.data(), len);
+    host_printer_input.erase(0, len);
+    return len;
+}
+
+long ESPCOM::baudRate(tpipe output)
+{
+    if (DEFAULT_PRINTER_PIPE != output) {
+        return 0;
+    }
+    return Serial.baudRate();
+}
+
+size_t ESPCOM::available(tpipe output)
+{
+    if (DEFAULT_PRINTER_PIPE != output) {
+        return 0;
+    }
+    return host_printer_input.size();
+}
+
+void ESPCOM::flush (tpipe output, ESPResponseStream  *espresponse)
+{
+    (void)output;
+    (void)espresponse;
+}
+
+void ESPCOM::configureSerialRx (long baud_rate)
+{
+    (void)baud_rate;
+}
+
+void ESPCOM::beginSerialTask() {}
+
+void ESPCOM::print (const __FlashStringHelper *data, tpipe output, ESPResponseStream  *espresponse)
+{
+    print ((const char *)data, output, espresponse);
+}
+
+void ESPCOM::print (String & data, tpipe output, ESPResponseStream  *espresponse)
+{
+    print (data.c_str(), output, espresponse);
+}
+
+void ESPCOM::print (const char * data, tpipe output, ESPResponseStream  *espresponse)
+{
+    if ((DEFAULT_PRINTER_PIPE == output) && block_2_printer) {
+        return;
+    }
+    if (WEB_PIPE == output) {
+        if (espresponse != NULL) {
+            espresponse->buffer_web += data;
+        }
+        return;
+    }
+    write (output, (const uint8_t *)data, strlen (data));
+}
+
+void ESPCOM::println (const __FlashStringHelper *data, tpipe output, ESPResponseStream  *espresponse)
+{
+    print ((const char *)data, output, espresponse);
+    print ("\r\n", output, espresponse);
+}
+
+void ESPCOM::println (String & data, tpipe output, ESPResponseStream  *espresponse)
+{
+    print (data.c_str(), output, espresponse);
+    print ("\r\n", output, espresponse);
+}
+
+void ESPCOM::println (const char * data, tpipe output, ESPResponseStream  *espresponse)
+{
+    print (data, output, espresponse);
+    print ("\r\n", output, espresponse);
+}
+
+bool ESPCOM::hasTCPClient()
+{
+    return host_tcp_client;
+}
+
+bool ESPCOM::printerLineFree()
+{
+    return !host_line_busy;
+}
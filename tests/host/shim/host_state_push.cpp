@@ -0,0 +1,21 @@
+/*
+  host_state_push.cpp - StatePush without websocket server
+
+  Values are kept, there is no client to send them to.
+*/
+
+#include "esp3d_stubs.h"
+#include "state_push.h"
+
+char StatePush::_values[STATE_TOPICS][STATE_PUSH_VALUE_SIZE];
+uint16_t StatePush::_versions[STATE_TOPICS];
+
+void StatePush::set (state_topic topic, const char * value)
+{
+    if (topic >= STATE_TOPICS) {
+        return;
+    }
+    strncpy (_values[topic], value, STATE_PUSH_VALUE_SIZE - 1);
+    _values[topic][STATE_PUSH_VALUE_SIZE - 1] = 0;
+    _versions[topic]++;
+}
@@ -0,0 +1,35 @@
+/*
+  test.h - checks for host tests
+
+  A failed check is reported and test goes on, main returns test_result().
+*/
+
+#ifndef _HOST_TEST_H
+#define _HOST_TEST_H
+#include <stdio.h>
+#include <string.h>
+#include "esp3d_stubs.h"
+
+static int test_failures = 0;
+
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+        test_failures++; \
+    } \
+} while (0)
+
+#define CHECK_STR(value, expected) do { \
+    if (strcmp((value), (expected)) != 0) { \
+        printf("%s:%d: \"%s\" is not \"%s\"\n", __FILE__, __LINE__, (value), (expected)); \
+        test_failures++; \
+    } \
+} while (0)
+
+static inline int test_result(const char * name)
+{
+    printf("%s: %s\n", name, test_failures ? "FAILED" : "ok");
+    return test_failures ? 1 : 0;
+}
+
+#endif //_HOST_TEST_H
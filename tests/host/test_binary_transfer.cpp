@@ -0,0 +1,265 @@
+/*
+  test_binary_transfer.cpp - BinaryTransfer packets against a fake Marlin
+  BINARY_FILE_TRANSFER receiver
+*/
+
+#include "test.h"
+#include "espcom.h"
+#include "binary_transfer.h"
+
+#define PRINTER_BLOCK_SIZE 128
+
+//Marlin feature/binary_stream.h
+static uint16_t marlin_checksum(uint16_t cs, uint8_t value)
+{
+    uint16_t cs_low = (((cs & 0xFF) + value) % 255);
+    return ((((cs >> 8) + cs_low) % 255) << 8) | cs_low;
+}
+
+static uint16_t fletcher16(const uint8_t * data, size_t len)
+{
+    uint16_t cs = 0;
+    for (size_t i = 0; i < len; i++) {
+        cs = marlin_checksum(cs, data[i]);
+    }
+    return cs;
+}
+
+//fake printer: ascii commands until M28 B1, then packets
+static bool binary_mode;
+static std::string ascii_line;
+static std::string rx;
+static uint8_t sync_number;
+static std::string file_name;
+static std::string file_data;
+static bool file_open;
+static int packets;
+static int bad_packets;
+//packet number whose payload gets a wrong bit once
+static int corrupt_packet;
+
+static void reply(const std::string & line)
+{
+    host_printer_reply((line + "\n").c_str());
+}
+
+static void ascii_command(const std::string & line)
+{
+    if (line == "M115") {
+        reply("FIRMWARE_NAME:Marlin");
+        reply("Cap:BINARY_FILE_TRANSFER:1");
+        reply("ok");
+    } else if (line == "M28 B1") {
+        reply("ok");
+        binary_mode = true;
+        sync_number = 0;
+    } else if (!line.empty()) {
+        reply("ok");
+    }
+}
+
+static void packet(uint8_t sync, uint8_t protocol, uint8_t type, const std::string & payload)
+{
+    if ((protocol == 0) && (type == 1)) {
+        reply("ss" + std::to_string(sync_number) + "," + std::to_string(PRINTER_BLOCK_SIZE) + ",0.1.0");
+        return;
+    }
+    if (sync != sync_number) {
+        reply("rs" + std::to_string(sync_number));
+        return;
+    }
+    reply("ok" + std::to_string(sync_number));
+    sync_number++;
+    if (protocol == 0) {
+        //close: back to ascii
+        binary_mode = false;
+        return;
+    }
+    switch (type) {
+    case 0:
+        reply("PFT:version:0.1:compression:none");
+        break;
+    case 1:
+        //dummy, compression, then name
+        file_name = payload.c_str() + 2;
+        file_data.clear();
+        file_open = true;
+        reply("PFT:success");
+        break;
+    case 2:
+        file_open = false;
+        reply("PFT:success");
+        break;
+    case 3:
+        file_data += payload;
+        break;
+    case 4:
+        file_open = false;
+        file_data.clear();
+        reply("PFT:success");
+        break;
+    }
+}
+
+static void parse_packets()
+{
+    while (rx.size() >= 8) {
+        const uint8_t * p = (const uint8_t *)rx.data();
+        if ((p[0] != 0xAD) || (p[1] != 0xB5)) {
+            rx.erase(0, 1);
+            continue;
+        }
+        uint16_t size = p[4] | (p[5] << 8);
+        size_t total = 8 + (size ? size + 2 : 0);
+        if (rx.size() < total) {
+            return;
+        }
+        std::string data = rx.substr(0, total);
+        rx.erase(0, total);
+        packets++;
+        if (packets == corrupt_packet) {
+            data[8] ^= 0x04;
+        }
+        p = (const uint8_t *)data.data();
+        uint16_t header_cs = p[6] | (p[7] << 8);
+        bool good = (fletcher16(p + 2, 4) == header_cs);
+        if (good && size) {
+            uint16_t packet_cs = p[8 + size] | (p[9 + size] << 8);
+            good = (fletcher16(p + 2, 6 + size) == packet_cs);
+        }
+        if (!good) {
+            bad_packets++;
+            reply("rs" + std::to_string(sync_number));
+            continue;
+        }
+        packet(p[2], p[3] >> 4, p[3] & 0x0F, data.substr(8, size));
+    }
+}
+
+static void printer_receive(const uint8_t * data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (binary_mode) {
+            rx += (char)data[i];
+            parse_packets();
+        } else if (data[i] == '\n') {
+            if (!ascii_line.empty() && (ascii_line[ascii_line.size() - 1] == '\r')) {
+                ascii_line.erase(ascii_line.size() - 1);
+            }
+            ascii_command(ascii_line);
+            ascii_line.clear();
+        } else {
+            ascii_line += (char)data[i];
+        }
+    }
+}
+
+static void start()
+{
+    host_reset();
+    CONFIG::SetFirmwareTarget(MARLIN);
+    host_printer_hook = printer_receive;
+    binary_mode = false;
+    ascii_line.clear();
+    rx.clear();
+    file_name.clear();
+    file_data.clear();
+    file_open = false;
+    packets = 0;
+    bad_packets = 0;
+    corrupt_packet = 0;
+}
+
+//checksum is fletcher-16 as Marlin computes it
+static void test_checksum()
+{
+    CHECK(fletcher16((const uint8_t *)"abcde", 5) == 0xC8F0);
+    CHECK(fletcher16((const uint8_t *)"abcdef", 6) == 0x2057);
+    CHECK(fletcher16((const uint8_t *)"abcdefgh", 8) == 0x0627);
+}
+
+//sync packet as it is on the wire
+static void test_framing()
+{
+    start();
+    host_printer_hook = NULL;
+    host_printer_reply("ok\n");
+    binary_transfer.begin("a.gco");
+    //M28 B1 then sync packet with sync 0, no payload
+    const char * cmd = "M28 B1\r\n";
+    CHECK(host_printer_output.compare(0, strlen(cmd), cmd) == 0);
+    const uint8_t * p = (const uint8_t *)host_printer_output.data() + strlen(cmd);
+    CHECK(host_printer_output.size() >= strlen(cmd) + 8);
+    CHECK((p[0] == 0xAD) && (p[1] == 0xB5));
+    CHECK((p[2] == 0) && (p[3] == 0x01) && (p[4] == 0) && (p[5] == 0));
+    uint16_t cs = fletcher16(p + 2, 4);
+    CHECK((p[6] == (cs & 0xFF)) && (p[7] == (cs >> 8)));
+}
+
+static std::string test_file(size_t size)
+{
+    std::string data;
+    for (size_t i = 0; i < size; i++) {
+        data += (char)((i * 7) & 0xFF);
+    }
+    return data;
+}
+
+//file is cut in printer blocks, each packet is checked by printer
+static void test_transfer()
+{
+    start();
+    CHECK(binary_transfer.supported());
+    std::string data = test_file(300);
+    CHECK(binary_transfer.begin("test.gco"));
+    CHECK(file_open);
+    CHECK(file_name == "test.gco");
+    CHECK(binary_transfer.write((const uint8_t *)data.data(), 100));
+    CHECK(binary_transfer.write((const uint8_t *)data.data() + 100, 200));
+    CHECK(binary_transfer.end());
+    CHECK(!file_open);
+    CHECK(file_data == data);
+    CHECK(bad_packets == 0);
+    CHECK(binary_transfer.bytesSent() == 300);
+    //back in ascii mode
+    CHECK(!binary_mode);
+}
+
+//a packet damaged on the wire is sent again
+static void test_resend()
+{
+    start();
+    //sync, query, open, then first write
+    corrupt_packet = 4;
+    std::string data = test_file(PRINTER_BLOCK_SIZE * 2);
+    CHECK(binary_transfer.begin("test.gco"));
+    CHECK(binary_transfer.write((const uint8_t *)data.data(), data.size()));
+    CHECK(binary_transfer.end());
+    CHECK(bad_packets == 1);
+    CHECK(binary_transfer.resendCount() == 1);
+    CHECK(file_data == data);
+}
+
+//abort removes file and leaves binary mode
+static void test_abort()
+{
+    start();
+    std::string data = test_file(10);
+    CHECK(binary_transfer.begin("test.gco"));
+    CHECK(binary_transfer.write((const uint8_t *)data.data(), data.size()));
+    binary_transfer.abort();
+    CHECK(!binary_transfer.started());
+    CHECK(!file_open);
+    CHECK(file_data.empty());
+    CHECK(!binary_mode);
+}
+
+int main()
+{
+    test_checksum();
+    test_framing();
+    test_transfer();
+    test_resend();
+    test_abort();
+    return test_result("binary_transfer");
+}
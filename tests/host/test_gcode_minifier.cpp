@@ -0,0 +1,74 @@
+/*
+  test_gcode_minifier.cpp - GcodeMinifier host test
+*/
+
+#include "test.h"
+#include "gcode_minifier.h"
+
+static char out[GCODE_MINIFIER_LINE_SIZE];
+
+static const char * minify(GcodeMinifier & minifier, const char * line)
+{
+    size_t size = minifier.minify(line, strlen(line), out);
+    CHECK(size == strlen(out));
+    CHECK(size <= strlen(line));
+    return out;
+}
+
+static void test_marlin()
+{
+    GcodeMinifier minifier;
+    minifier.begin(MARLIN);
+    CHECK_STR(minify(minifier, "G1 X10.500 Y020.000 F1800.0 ; move"), "G1X10.5Y20F1800");
+    //same feedrate is not sent again
+    CHECK_STR(minify(minifier, "G1 X11 Y21 F1800"), "G1X11Y21");
+    CHECK_STR(minify(minifier, "G01 X-0.000 Y.500 E+0.50000"), "G1X-0Y.5E0.5");
+    //other commands are only trimmed
+    CHECK_STR(minify(minifier, "  M117 Hello 1.50  "), "M117 Hello 1.50");
+    //and feedrate is forgotten
+    CHECK_STR(minify(minifier, "G1 F1800 X2"), "G1F1800X2");
+    CHECK_STR(minify(minifier, "G0 X1 F1800"), "G0X1F1800");
+    CHECK_STR(minify(minifier, "G1 X3 F1800"), "G1X3F1800");
+    //G38.2 is kept as it is
+    CHECK_STR(minify(minifier, "G38.2 Z-10.0"), "G38.2Z-10");
+    //lines which are not simple words are only trimmed
+    CHECK_STR(minify(minifier, "G1 X1 (c)"), "G1 X1 (c)");
+    CHECK_STR(minify(minifier, "g1 x1"), "g1 x1");
+    CHECK_STR(minify(minifier, "N12 G1 X1"), "N12 G1 X1");
+    CHECK(minifier.minify("; only comment", 14, out) == 0);
+    CHECK(minifier.minify("", 0, out) == 0);
+    CHECK(minifier.bytesOut() < minifier.bytesIn());
+}
+
+static void test_spaces()
+{
+    GcodeMinifier minifier;
+    //Repetier needs spaces between words
+    minifier.begin(REPETIER);
+    CHECK_STR(minify(minifier, "G1  X10.500   Y020.000"), "G1 X10.5 Y20");
+    CHECK_STR(minify(minifier, "G1X1Y2"), "G1X1Y2");
+}
+
+static void test_grbl()
+{
+    GcodeMinifier minifier;
+    minifier.begin(GRBL);
+    CHECK_STR(minify(minifier, "G0 X1"), "G0X1");
+    CHECK_STR(minify(minifier, "G1 X2 F100"), "G1X2F100");
+    //motion mode is kept by Grbl
+    CHECK_STR(minify(minifier, "G1 X3 F100"), "X3");
+    CHECK_STR(minify(minifier, "G1 F200"), "F200");
+    CHECK_STR(minify(minifier, "G1"), "G1");
+    CHECK_STR(minify(minifier, "G0 Y1"), "G0Y1");
+    //a non G line forgets motion mode
+    minify(minifier, "M3 S1000");
+    CHECK_STR(minify(minifier, "G0 Y2"), "G0Y2");
+}
+
+int main()
+{
+    test_marlin();
+    test_spaces();
+    test_grbl();
+    return test_result("gcode_minifier");
+}
@@ -0,0 +1,143 @@
+/*
+  test_gcode_streamer.cpp - GcodeStreamer window and resend against a
+  scripted printer port
+*/
+
+#include "test.h"
+#include "espcom.h"
+#include "gcode_streamer.h"
+
+//line numbers of lines sent to printer since last call
+static std::string sent_numbers()
+{
+    std::string numbers;
+    size_t pos = 0;
+    size_t eol;
+    while ((eol = host_printer_output.find('\n', pos)) != std::string::npos) {
+        if (host_printer_output[pos] == 'N') {
+            numbers += host_printer_output.substr(pos + 1, host_printer_output.find(' ', pos) - pos - 1);
+            numbers += ' ';
+        }
+        pos = eol + 1;
+    }
+    host_printer_output.erase(0, pos);
+    return numbers;
+}
+
+static void start()
+{
+    host_reset();
+    CONFIG::SetFirmwareTarget(MARLIN);
+}
+
+//lines are sent without waiting their ok until window is full
+static void test_window()
+{
+    start();
+    CHECK(gcode_streamer.begin(1, 3));
+    CHECK(gcode_streamer.push("G1 X1"));
+    CHECK(gcode_streamer.push("G1 X2"));
+    CHECK(gcode_streamer.push("G1 X3"));
+    CHECK(sent_numbers() == "1 2 3 ");
+    //no time spent waiting
+    CHECK(millis() == 0);
+    //each ok makes room for one line
+    host_printer_reply("ok\n");
+    CHECK(gcode_streamer.push("G1 X4"));
+    CHECK(sent_numbers() == "4 ");
+    //temperature report is not an ok
+    host_printer_reply(" T:210.0 /210.0 B:60.0 /60.0 @:64\nok\nok\nok\n");
+    CHECK(gcode_streamer.drain());
+    CHECK(gcode_streamer.linesSent() == 4);
+    gcode_streamer.end();
+}
+
+//bytes in flight never go beyond printer rx buffer
+static void test_rx_size()
+{
+    start();
+    //"N1 G1 X1.000 Y1.000*nn\n" is 23 or 24 bytes
+    CHECK(gcode_streamer.begin(1, 4, 50));
+    CHECK(gcode_streamer.push("G1 X1.000 Y1.000"));
+    CHECK(gcode_streamer.push("G1 X2.000 Y2.000"));
+    CHECK(sent_numbers() == "1 2 ");
+    host_printer_reply("ok\n");
+    CHECK(gcode_streamer.push("G1 X3.000 Y3.000"));
+    CHECK(sent_numbers() == "3 ");
+    host_printer_reply("ok\nok\n");
+    CHECK(gcode_streamer.drain());
+    gcode_streamer.end();
+}
+
+//a corrupted line is sent again with the ones after it, the resend
+//requests of lines already in printer buffer are ignored
+static void test_resend()
+{
+    start();
+    CHECK(gcode_streamer.begin(1, 3));
+    CHECK(gcode_streamer.push("G1 X1"));
+    CHECK(gcode_streamer.push("G1 X2"));
+    CHECK(gcode_streamer.push("G1 X3"));
+    CHECK(sent_numbers() == "1 2 3 ");
+    host_printer_reply("ok\n");
+    host_printer_reply("Error:checksum mismatch, Last Line: 1\nResend: 2\nok\n");
+    host_printer_reply("Error:Line Number is not Last Line Number+1, Last Line: 1\nResend: 2\nok\n");
+    CHECK(gcode_streamer.process());
+    CHECK(sent_numbers() == "2 3 ");
+    CHECK(gcode_streamer.resendCount() == 1);
+    host_printer_reply("ok\nok\n");
+    CHECK(gcode_streamer.drain());
+    CHECK(!gcode_streamer.failed());
+    CHECK(gcode_streamer.nextLineNumber() == 4);
+    gcode_streamer.end();
+}
+
+//smoothieware asks with rs
+static void test_rs()
+{
+    start();
+    CONFIG::SetFirmwareTarget(SMOOTHIEWARE);
+    CHECK(gcode_streamer.begin(10, 2));
+    CHECK(gcode_streamer.push("G1 X1"));
+    CHECK(gcode_streamer.push("G1 X2"));
+    CHECK(sent_numbers() == "10 11 ");
+    host_printer_reply("rs N10\nok\n");
+    CHECK(gcode_streamer.process());
+    host_printer_reply("rs N10\nok\n");
+    CHECK(gcode_streamer.process());
+    CHECK(sent_numbers() == "10 11 ");
+    host_printer_reply("ok\nok\n");
+    CHECK(gcode_streamer.drain());
+    CHECK(gcode_streamer.resendCount() == 1);
+    gcode_streamer.end();
+}
+
+//request of a line never sent or no answer at all is a failure
+static void test_errors()
+{
+    start();
+    CHECK(gcode_streamer.begin(1, 2));
+    CHECK(gcode_streamer.push("G1 X1"));
+    host_printer_reply("Resend: 7\n");
+    CHECK(!gcode_streamer.process());
+    CHECK(gcode_streamer.failed());
+    CHECK(!gcode_streamer.push("G1 X2"));
+    gcode_streamer.end();
+    start();
+    CHECK(gcode_streamer.begin(1, 2));
+    CHECK(gcode_streamer.push("G1 X1"));
+    CHECK(!gcode_streamer.drain());
+    CHECK(gcode_streamer.failed());
+    CHECK(millis() > SERIAL_STREAM_TIMEOUT);
+    gcode_streamer.end();
+}
+
+int main()
+{
+    test_window();
+    test_rx_size();
+    test_resend();
+    test_rs();
+    test_errors();
+    return test_result("gcode_streamer");
+}
@@ -0,0 +1,90 @@
+/*
+  test_line_assembler.cpp - LineAssembler host test
+*/
+
+#include "test.h"
+#include "line_assembler.h"
+
+//feed whole text, return number of lines, last one is in assembler
+static int feed_all(LineAssembler & assembler, const char * text, size_t chunk, char lines[][LINE_ASSEMBLER_SIZE + 1])
+{
+    const uint8_t * data = (const uint8_t *)text;
+    size_t len = strlen(text);
+    int count = 0;
+    while (len > 0) {
+        size_t size = (len < chunk) ? len : chunk;
+        const uint8_t * p = data;
+        size_t left = size;
+        while (left > 0) {
+            size_t used = assembler.feed(p, left);
+            p += used;
+            left -= used;
+            if (assembler.ready()) {
+                CHECK(strlen(assembler.line()) == assembler.length());
+                strcpy(lines[count++], assembler.line());
+            }
+        }
+        data += size;
+        len -= size;
+    }
+    return count;
+}
+
+static void test_chunks()
+{
+    static char lines[8][LINE_ASSEMBLER_SIZE + 1];
+    const char * text = "ok\nT:20.1 /0.0 B:20.3 /0.0\r\nResend: 12\r\necho:busy: processing\n";
+    for (size_t chunk = 1; chunk <= 16; chunk++) {
+        LineAssembler assembler;
+        int count = feed_all(assembler, text, chunk, lines);
+        CHECK(count == 4);
+        if (count == 4) {
+            CHECK_STR(lines[0], "ok");
+            CHECK_STR(lines[1], "T:20.1 /0.0 B:20.3 /0.0");
+            CHECK_STR(lines[2], "Resend: 12");
+            CHECK_STR(lines[3], "echo:busy: processing");
+        }
+    }
+}
+
+static void test_filters()
+{
+    static char lines[8][LINE_ASSEMBLER_SIZE + 1];
+    LineAssembler assembler;
+    //comment removed, empty lines skipped, binary garbage resets line
+    int count = feed_all(assembler, "G1 X1 ; move\n\n\r\nab\x01" "cd\n", 3, lines);
+    CHECK(count == 2);
+    if (count == 2) {
+        CHECK_STR(lines[0], "G1 X1 ");
+        CHECK_STR(lines[1], "cd");
+    }
+}
+
+static void test_overflow()
+{
+    static char lines[4][LINE_ASSEMBLER_SIZE + 1];
+    static char text[LINE_ASSEMBLER_SIZE + 16];
+    LineAssembler assembler;
+    memset(text, 'A', LINE_ASSEMBLER_SIZE + 1);
+    strcpy(text + LINE_ASSEMBLER_SIZE + 1, "\nok\n");
+    //too long line is dropped, next one is fine
+    int count = feed_all(assembler, text, 64, lines);
+    CHECK(count == 1);
+    if (count == 1) {
+        CHECK_STR(lines[0], "ok");
+    }
+    memset(text, 'A', LINE_ASSEMBLER_SIZE);
+    strcpy(text + LINE_ASSEMBLER_SIZE, "\n");
+    assembler.reset();
+    count = feed_all(assembler, text, 64, lines);
+    CHECK(count == 1);
+    CHECK(assembler.length() == LINE_ASSEMBLER_SIZE);
+}
+
+int main()
+{
+    test_chunks();
+    test_filters();
+    test_overflow();
+    return test_result("line_assembler");
+}
@@ -0,0 +1,73 @@
+/*
+  test_line_framer.cpp - LineFramer host test
+*/
+
+#include "test.h"
+#include "line_framer.h"
+
+static uint8_t xor_of(const char * data, size_t len)
+{
+    uint8_t cs = 0;
+    for (size_t i = 0; i < len; i++) {
+        cs ^= (uint8_t)data[i];
+    }
+    return cs;
+}
+
+static void test_numbered()
+{
+    char buffer[LINE_FRAMER_SIZE];
+    size_t n = LineFramer::frame(buffer, sizeof(buffer), "G1 X10", 6, 12345);
+    CHECK_STR(buffer, "N12345 G1 X10*80\n");
+    CHECK(n == strlen(buffer));
+    //checksum is xor of all before *
+    CHECK(xor_of("N12345 G1 X10", 13) == 80);
+    n = LineFramer::frame(buffer, sizeof(buffer), "M110 N0", 7, 0);
+    CHECK_STR(buffer, "N0 M110 N0*125\n");
+    CHECK(n == 15);
+}
+
+static void test_unnumbered()
+{
+    char buffer[LINE_FRAMER_SIZE];
+    size_t n = LineFramer::frame(buffer, sizeof(buffer), "M105", 4, -1);
+    CHECK_STR(buffer, "M105\n");
+    CHECK(n == 5);
+}
+
+static void test_size()
+{
+    char buffer[32];
+    //N1 space *cs \n and 0 take 8 chars at most with one digit
+    const char * line = "G1 X1 Y2 Z3 E4 F1800 G1 X";
+    size_t len = strlen(line);
+    CHECK(LineFramer::frame(buffer, len + 9, line, len, 1) > 0);
+    CHECK(LineFramer::frame(buffer, len + 8, line, len, 1) == 0);
+    CHECK(LineFramer::frame(buffer, 6, "M105", 4, -1) == 5);
+    CHECK(LineFramer::frame(buffer, 5, "M105", 4, -1) == 0);
+}
+
+static void test_checksums()
+{
+    char buffer[LINE_FRAMER_SIZE];
+    char payload[64];
+    for (int32_t number = 0; number < 2000; number += 7) {
+        snprintf(payload, sizeof(payload), "G1 X%d.%d E%d", number, number % 10, number * 3);
+        size_t n = LineFramer::frame(buffer, sizeof(buffer), payload, strlen(payload), number);
+        const char * star = strchr(buffer, '*');
+        CHECK(star != NULL);
+        CHECK(n == strlen(buffer));
+        if (star) {
+            CHECK(atoi(star + 1) == xor_of(buffer, star - buffer));
+        }
+    }
+}
+
+int main()
+{
+    test_numbered();
+    test_unnumbered();
+    test_size();
+    test_checksums();
+    return test_result("line_framer");
+}
@@ -0,0 +1,144 @@
+/*
+  test_meatpack.cpp - MeatPack encoder host test
+
+  Packed data are unpacked the way Marlin does (feature/meatpack.cpp)
+*/
+
+#include "test.h"
+#include "meatpack.h"
+
+static const char unpacked[15] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', ' ', '\n', 'G', 'X'};
+
+//data bytes only, printer commands are not expected
+static size_t unpack(const uint8_t * data, size_t len, char * out)
+{
+    size_t n = 0;
+    uint8_t literals = 0;
+    char second = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+        if (literals > 0) {
+            out[n++] = c;
+            //packed second char comes after literal first one
+            if (second) {
+                out[n++] = second;
+                second = 0;
+            }
+            literals--;
+            continue;
+        }
+        uint8_t low = c & 0x0F;
+        uint8_t high = c >> 4;
+        if (low == 0x0F) {
+            literals++;
+            if (high == 0x0F) {
+                literals++;
+            } else {
+                second = unpacked[high];
+            }
+        } else {
+            out[n++] = unpacked[low];
+            //other half of a byte starting by end of line is ignored
+            if (unpacked[low] != '\n') {
+                if (high == 0x0F) {
+                    literals++;
+                } else {
+                    out[n++] = unpacked[high];
+                }
+            }
+        }
+    }
+    return n;
+}
+
+static size_t encode(const char * text, uint8_t * out, size_t size = 64)
+{
+    size_t used;
+    size_t n = MeatPack::encode((const uint8_t *)text, strlen(text), out, size, used);
+    CHECK(used == strlen(text));
+    return n;
+}
+
+static void test_bytes()
+{
+    uint8_t out[64];
+    //first char is low half
+    CHECK((encode("G1", out) == 1) && (out[0] == 0x1D));
+    CHECK((encode("1\n", out) == 1) && (out[0] == 0xC1));
+    //literal chars follow packed byte in order
+    CHECK((encode("M1", out) == 2) && (out[0] == 0x1F) && (out[1] == 'M'));
+    CHECK((encode("1M", out) == 2) && (out[0] == 0xF1) && (out[1] == 'M'));
+    CHECK((encode("AB", out) == 3) && (out[0] == 0xFF) && (out[1] == 'A') && (out[2] == 'B'));
+    //end of line starting a byte is alone in it
+    CHECK((encode("\n", out) == 1) && (out[0] == 0x0C));
+    CHECK((encode("\nG1", out) == 2) && (out[0] == 0x0C) && (out[1] == 0x1D));
+}
+
+static void test_pending()
+{
+    uint8_t out[64];
+    //char without its pair waits for next call
+    CHECK(encode("G", out) == 0);
+    CHECK((encode("1", out) == 1) && (out[0] == 0x1D));
+    CHECK(encode("G1 ", out) == 1);
+    CHECK((encode("X\n", out) == 2) && (out[0] == 0xEB) && (out[1] == 0x0C));
+    CHECK((encode("\n", out) == 1) && (out[0] == 0x0C));
+    //out too small for a pair: nothing is taken
+    size_t used;
+    CHECK((MeatPack::encode((const uint8_t *)"AB", 2, out, 2, used) == 0) && (used == 0));
+    CHECK((MeatPack::encode((const uint8_t *)"ABCD", 4, out, 3, used) == 3) && (used == 2));
+    CHECK((encode("CD", out) == 3) && (out[1] == 'C') && (out[2] == 'D'));
+}
+
+static void test_round_trip()
+{
+    const char * text = "G1 X10.5 Y20 E0.123\nM105\nG28\nM117 Hello world\n\n"
+                        "N12 G1 X1*34\nA\nAB\nG1 F1800\r\nT0\nG92 E0\n";
+    size_t len = strlen(text);
+    static uint8_t packed[512];
+    static char result[512];
+    //any cut of data and any room in out give same result
+    for (size_t chunk = 1; chunk <= 7; chunk++) {
+        for (size_t room = 3; room <= 8; room++) {
+            size_t size = 0;
+            size_t done = 0;
+            while (done < len) {
+                size_t cut = ((len - done) < chunk) ? (len - done) : chunk;
+                size_t taken = 0;
+                while (taken < cut) {
+                    size_t used;
+                    size += MeatPack::encode((const uint8_t *)text + done + taken, cut - taken, packed + size, room, used);
+                    taken += used;
+                }
+                done += cut;
+            }
+            size_t n = unpack(packed, size, result);
+            result[n] = '\0';
+            CHECK_STR(result, text);
+            CHECK(size < len);
+        }
+    }
+}
+
+static void test_commands()
+{
+    uint8_t out[64];
+    host_printer_output.clear();
+    MeatPack::update("[MP] PV01 ON ESP", 16);
+    CHECK(MeatPack::active());
+    CHECK(encode("G", out) == 0);
+    //waiting char is sent as it is after command
+    MeatPack::setEnabled(false);
+    CHECK(!MeatPack::active());
+    CHECK(host_printer_output == std::string("\xFF\xFF\xFA" "G", 4));
+    CHECK((encode("G1", out) == 1) && (out[0] == 0x1D));
+}
+
+int main()
+{
+    test_bytes();
+    test_pending();
+    test_round_trip();
+    test_commands();
+    return test_result("meatpack");
+}
@@ -0,0 +1,252 @@
+/*
+  test_printer_sim.cpp - streamer, queries and answers parsing against
+  the fake printer of each firmware
+*/
+
+#include "test.h"
+#include "printer_sim.h"
+#include "espcom.h"
+#include "gcode_streamer.h"
+#include "serial_query.h"
+#include "line_assembler.h"
+#include "response_classifier.h"
+#ifdef MEATPACK_FEATURE
+#include "meatpack.h"
+#endif
+
+#define STREAM_LINES 200
+
+static std::string gcode_line (int i)
+{
+    char line[64];
+    snprintf (line, sizeof (line), "G1 X%d.%d Y%d E%d.%03d", 10 + (i % 90), i % 10, 20 + (i % 50), i / 100, i % 1000);
+    return line;
+}
+
+static void start (const printer_sim_config & config)
+{
+    host_reset();
+    CONFIG::SetFirmwareTarget (config.firmware);
+    PrinterSim::begin (config);
+}
+
+//return simulated time taken
+static uint64_t stream (uint8_t window)
+{
+    uint64_t start_time = host_micros;
+    CHECK (gcode_streamer.begin (1, window));
+    for (int i = 0; i < STREAM_LINES; i++) {
+        if (!gcode_streamer.push (gcode_line (i).c_str())) {
+            break;
+        }
+    }
+    CHECK (gcode_streamer.drain());
+    CHECK (!gcode_streamer.failed());
+    gcode_streamer.end();
+    return host_micros - start_time;
+}
+
+static void check_done()
+{
+    const std::vector<std::string> & done = PrinterSim::done();
+    CHECK (done.size() == STREAM_LINES);
+    bool same = true;
+    for (size_t i = 0; (i < done.size()) && same; i++) {
+        same = (done[i] == gcode_line (i));
+    }
+    CHECK (same);
+    CHECK (PrinterSim::lastLineNumber() == STREAM_LINES);
+}
+
+//corrupted lines are sent again, temperature reports do not move window
+static void test_stream (uint8_t firmware, bool advanced_ok)
+{
+    printer_sim_config config = PrinterSim::defaults (firmware);
+    config.corrupt_every = 17;
+    config.report_us = 100000;
+    config.advanced_ok = advanced_ok;
+    start (config);
+    stream (SERIAL_STREAM_WINDOW);
+    check_done();
+    CHECK (PrinterSim::corrupted() > 0);
+    CHECK (gcode_streamer.resendCount() == PrinterSim::corrupted());
+    //window never goes beyond printer buffer
+    CHECK (PrinterSim::overflows() == 0);
+    PrinterSim::end();
+}
+
+//printer does a line while next ones are on the wire
+static void test_window()
+{
+    printer_sim_config config = PrinterSim::defaults (MARLIN);
+    config.baud = 250000;
+    start (config);
+    uint64_t one = stream (1);
+    check_done();
+    start (config);
+    uint64_t four = stream (4);
+    check_done();
+    CHECK (PrinterSim::overflows() == 0);
+    CHECK (four < ((one * 3) / 4));
+    PrinterSim::end();
+}
+
+//a slow printer with a small buffer is never overflowed
+static void test_small_buffer()
+{
+    printer_sim_config config = PrinterSim::defaults (MARLIN);
+    config.rx_size = 64;
+    config.line_us = 5000;
+    start (config);
+    CHECK (gcode_streamer.begin (1, SERIAL_STREAM_WINDOW, 64));
+    for (int i = 0; i < 50; i++) {
+        gcode_streamer.push (gcode_line (i).c_str());
+    }
+    CHECK (gcode_streamer.drain());
+    gcode_streamer.end();
+    CHECK (PrinterSim::overflows() == 0);
+    CHECK (PrinterSim::done().size() == 50);
+    PrinterSim::end();
+}
+
+static std::string query_answer;
+static query_status query_result;
+static bool query_finished;
+
+static void on_query_line (const char * line, size_t len, void * context)
+{
+    (void)context;
+    query_answer.append (line, len);
+    query_answer += '|';
+}
+
+static void on_query_done (query_status status, void * context)
+{
+    (void)context;
+    query_result = status;
+    query_finished = true;
+}
+
+//main loop part which matters for queries
+static void run_query()
+{
+    uint8_t buf[64];
+    for (int i = 0; (i < 100000) && !query_finished; i++) {
+        serial_query.process();
+        size_t len = ESPCOM::readBytes (DEFAULT_PRINTER_PIPE, buf, sizeof (buf));
+        serial_query.feed (buf, len);
+        yield();
+    }
+}
+
+static void test_query (uint8_t firmware, const char * cmd, const char * expected)
+{
+    printer_sim_config config = PrinterSim::defaults (firmware);
+    config.report_us = 1000;
+    start (config);
+    query_answer.clear();
+    query_finished = false;
+    CHECK (serial_query.queue (cmd, on_query_line, on_query_done, NULL));
+    run_query();
+    CHECK (query_finished && (query_result == QUERY_DONE));
+    //auto reports in the middle are part of answer
+    CHECK (query_answer.find (expected) != std::string::npos);
+    PrinterSim::end();
+}
+
+//printer output is assembled in lines and classified as ESP does
+static void test_answers (uint8_t firmware, const char * cmd, int expected_temperatures)
+{
+    printer_sim_config config = PrinterSim::defaults (firmware);
+    config.report_us = 1000;
+    start (config);
+    ESPCOM::println (cmd, DEFAULT_PRINTER_PIPE);
+    delay (10);
+    LineAssembler assembler;
+    int acks = 0;
+    int temperatures = 0;
+    int status = 0;
+    size_t pos = 0;
+    while (pos < host_printer_input.size()) {
+        pos += assembler.feed ((const uint8_t *)host_printer_input.data() + pos, host_printer_input.size() - pos);
+        if (!assembler.ready()) {
+            continue;
+        }
+        response_info response;
+        ResponseClassifier::classify (assembler.line(), assembler.length(), response);
+        acks += (response.type == RESPONSE_ACK) ? 1 : 0;
+        temperatures += response.temperature ? 1 : 0;
+        status += (assembler.line()[0] == '<') ? 1 : 0;
+    }
+    CHECK (acks == 1);
+    CHECK (temperatures >= expected_temperatures);
+    if (firmware == GRBL) {
+        CHECK (status >= 5);
+    }
+    PrinterSim::end();
+}
+
+#ifdef MEATPACK_FEATURE
+//printer output goes to MeatPack as command.cpp does
+static void meatpack_answers()
+{
+    static LineAssembler assembler;
+    size_t pos = 0;
+    while (pos < host_printer_input.size()) {
+        pos += assembler.feed ((const uint8_t *)host_printer_input.data() + pos, host_printer_input.size() - pos);
+        if (assembler.ready()) {
+            MeatPack::update (assembler.line(), assembler.length());
+        }
+    }
+    host_printer_input.clear();
+}
+
+//MeatPack is negotiated with Marlin, then streamed lines are unpacked
+//by printer as they were sent with less bytes on the wire
+static void test_meatpack()
+{
+    printer_sim_config config = PrinterSim::defaults (MARLIN);
+    config.corrupt_every = 17;
+    start (config);
+    stream (SERIAL_STREAM_WINDOW);
+    uint32_t plain = PrinterSim::wireBytes();
+    config.meatpack = true;
+    start (config);
+    for (int i = 0; (i < 1000) && !MeatPack::active(); i++) {
+        MeatPack::poll();
+        meatpack_answers();
+        yield();
+    }
+    CHECK (MeatPack::active());
+    uint32_t wire_start = PrinterSim::wireBytes();
+    stream (SERIAL_STREAM_WINDOW);
+    check_done();
+    CHECK (gcode_streamer.resendCount() == PrinterSim::corrupted());
+    uint32_t packed = PrinterSim::wireBytes() - wire_start;
+    CHECK ((packed * 10) < (plain * 8));
+    //printer restart ends packing
+    MeatPack::update ("start", 5);
+    CHECK (!MeatPack::active());
+    PrinterSim::end();
+}
+#endif
+
+int main()
+{
+    test_stream (MARLIN, false);
+    test_stream (MARLIN, true);
+    test_stream (REPETIER, false);
+    test_stream (SMOOTHIEWARE, false);
+    test_window();
+    test_small_buffer();
+    test_query (MARLIN, "M114", "X:10.00 Y:20.00");
+    test_query (REPETIER, "M105", "T:210.0");
+    test_query (SMOOTHIEWARE, "M114", "Count X:800");
+    test_query (GRBL, "$I", "[VER:1.1h");
+    test_answers (MARLIN, "M105", 5);
+    test_answers (GRBL, "$I", 0);
+#ifdef MEATPACK_FEATURE
+    test_meatpack();
+#endif
+    return test_result ("printer_sim");
+}
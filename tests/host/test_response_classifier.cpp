@@ -0,0 +1,98 @@
+/*
+  test_response_classifier.cpp - ResponseClassifier host test
+*/
+
+#include "test.h"
+#include "response_classifier.h"
+
+static response_info classify(const char * line)
+{
+    response_info response;
+    ResponseClassifier::classify(line, strlen(line), response);
+    return response;
+}
+
+static void test_marlin()
+{
+    ResponseClassifier::setFirmware(MARLIN);
+    CHECK(!ResponseClassifier::ackHasLineNumber());
+    response_info r = classify("ok");
+    CHECK((r.type == RESPONSE_ACK) && (r.number == -1));
+    //advanced ok
+    r = classify("ok N12 P15 B3");
+    CHECK((r.type == RESPONSE_ACK) && (r.number == 12));
+    r = classify("ok T:20.1 /0.0 B:20.3 /0.0 @:0 B@:0");
+    CHECK((r.type == RESPONSE_ACK) && r.temperature);
+    r = classify("Resend: 42");
+    CHECK((r.type == RESPONSE_RESEND) && (r.number == 42));
+    r = classify(" T:210.0 /210.0 B:60.0 /60.0");
+    CHECK((r.type == RESPONSE_NONE) && r.temperature);
+    r = classify("echo:busy: processing");
+    CHECK((r.type == RESPONSE_ECHO) && !r.temperature);
+    r = classify("Error:Line Number is not Last Line Number+1, Last Line: 7");
+    CHECK(r.type == RESPONSE_ERROR);
+    r = classify("wait");
+    CHECK(r.type == RESPONSE_WAIT);
+}
+
+static void test_esp_command()
+{
+    ResponseClassifier::setFirmware(MARLIN);
+    const char * line = "echo:[ESP201]P=2 V=1";
+    response_info r = classify(line);
+    CHECK((r.type == RESPONSE_ESP_COMMAND) && (r.number == 201));
+    CHECK((r.data == line + 13) && (r.size == 7));
+    r = classify("[ESP800]");
+    CHECK((r.type == RESPONSE_ESP_COMMAND) && (r.number == 800) && (r.size == 0));
+    //too far in line, it is not a command sent by printer
+    r = classify("echo:text [ESP800]");
+    CHECK(r.type == RESPONSE_ECHO);
+    //only Smoothieware sends lower case
+    r = classify("[esp800]");
+    CHECK(r.type == RESPONSE_NONE);
+    ResponseClassifier::setFirmware(SMOOTHIEWARE);
+    r = classify("[esp800]");
+    CHECK((r.type == RESPONSE_ESP_COMMAND) && (r.number == 800));
+}
+
+static void test_repetier()
+{
+    ResponseClassifier::setFirmware(REPETIER);
+    CHECK(ResponseClassifier::ackHasLineNumber());
+    response_info r = classify("ok 123");
+    CHECK((r.type == RESPONSE_ACK) && (r.number == 123));
+    r = classify("skip 124");
+    CHECK((r.type == RESPONSE_SKIP) && (r.number == 124));
+    r = classify("busy:processing");
+    CHECK(r.type == RESPONSE_BUSY);
+    r = classify("Resend:125");
+    CHECK((r.type == RESPONSE_RESEND) && (r.number == 125));
+}
+
+static void test_others()
+{
+    ResponseClassifier::setFirmware(SMOOTHIEWARE);
+    response_info r = classify("rs N33");
+    CHECK((r.type == RESPONSE_RESEND) && (r.number == 33));
+    r = classify("!!");
+    CHECK(r.type == RESPONSE_ERROR);
+    ResponseClassifier::setFirmware(GRBL);
+    r = classify("ok");
+    CHECK(r.type == RESPONSE_ACK);
+    r = classify("error:22");
+    CHECK((r.type == RESPONSE_ERROR) && (r.number == 22));
+    r = classify("ALARM:1");
+    CHECK((r.type == RESPONSE_ERROR) && (r.number == 1));
+    //Marlin resend is not known by Grbl
+    r = classify("Resend: 3");
+    CHECK(r.type == RESPONSE_NONE);
+}
+
+int main()
+{
+    test_marlin();
+    test_esp_command();
+    test_repetier();
+    test_others();
+    return test_result("response_classifier");
+}
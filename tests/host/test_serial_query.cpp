@@ -0,0 +1,119 @@
+/*
+  test_serial_query.cpp - SerialQuery queue, printer line sharing and
+  end of answer
+*/
+
+#include "test.h"
+#include "espcom.h"
+#include "webinterface.h"
+#include "serial_query.h"
+
+static std::string answer;
+static int done_count;
+static query_status done_status;
+
+static void on_line(const char * line, size_t len, void * context)
+{
+    (void)context;
+    answer.append(line, len);
+    answer += '|';
+}
+
+static void on_done(query_status status, void * context)
+{
+    (void)context;
+    done_status = status;
+    done_count++;
+}
+
+static void start()
+{
+    host_reset();
+    CONFIG::SetFirmwareTarget(MARLIN);
+    answer.clear();
+    done_count = 0;
+}
+
+//printer answer is read as main loop does
+static void feed_answer(const char * data)
+{
+    serial_query.feed((const uint8_t *)data, strlen(data));
+}
+
+//query waits for a client line to be complete and never blocks clients
+static void test_line_owner()
+{
+    start();
+    host_line_busy = true;
+    CHECK(serial_query.queue("M114", on_line, on_done, NULL));
+    serial_query.process();
+    CHECK(!serial_query.active());
+    CHECK(host_printer_output.empty());
+    host_line_busy = false;
+    serial_query.process();
+    CHECK(serial_query.active());
+    CHECK(host_printer_output == "M114\r\n");
+    //upload lock is left to uploads
+    CHECK(!web_interface->blockserial);
+    feed_answer("X:10.00 Y:20.00 Z:0.30 E:0.00 Count X:800 Y:1600 Z:120\nok\n");
+    CHECK(done_count == 1);
+    CHECK(done_status == QUERY_DONE);
+    CHECK(answer == "X:10.00 Y:20.00 Z:0.30 E:0.00 Count X:800 Y:1600 Z:120|ok|");
+    CHECK(!serial_query.active());
+}
+
+//sd upload keeps printer line, queries wait for it
+static void test_upload()
+{
+    start();
+    web_interface->blockserial = true;
+    CHECK(serial_query.queue("M105", on_line, on_done, NULL));
+    serial_query.process();
+    CHECK(!serial_query.active());
+    web_interface->blockserial = false;
+    serial_query.process();
+    CHECK(serial_query.active());
+    feed_answer("ok T:210.0 /210.0 B:60.0 /60.0 @:64\n");
+    CHECK(done_count == 1);
+    CHECK(done_status == QUERY_DONE);
+}
+
+//queries are sent one at a time in order
+static void test_queue()
+{
+    start();
+    CHECK(serial_query.queue("M115", on_line, on_done, NULL));
+    CHECK(serial_query.queue("M114", on_line, on_done, NULL));
+    serial_query.process();
+    serial_query.process();
+    CHECK(host_printer_output == "M115\r\n");
+    feed_answer("FIRMWARE_NAME:Marlin\nok\n");
+    serial_query.process();
+    CHECK(host_printer_output == "M115\r\nM114\r\n");
+    feed_answer("X:0.00 Y:0.00\nok\n");
+    CHECK(done_count == 2);
+    CHECK(serial_query.pending() == 0);
+}
+
+//no answer ends query after a while
+static void test_timeout()
+{
+    start();
+    CHECK(serial_query.queue("M114", on_line, on_done, NULL));
+    serial_query.process();
+    CHECK(serial_query.active());
+    delay(SERIAL_QUERY_TIMEOUT + 1);
+    serial_query.process();
+    CHECK(done_count == 1);
+    CHECK(done_status == QUERY_TIMEOUT);
+    CHECK(!serial_query.active());
+}
+
+int main()
+{
+    test_line_owner();
+    test_upload();
+    test_queue();
+    test_timeout();
+    return test_result("serial_query");
+}
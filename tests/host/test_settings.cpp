@@ -0,0 +1,126 @@
+/*
+  test_settings.cpp - settings image, commits and [ESP400] output
+*/
+
+#include "test.h"
+#include "config.h"
+#include "espcom.h"
+#include <EEPROM.h>
+
+//[ESP400] of default settings as firmware printed it before the
+//settings table, only stray spaces of hostname entry are removed
+#define ESP400_GOLDEN "data/esp400.json"
+
+static std::string read_file(const char * path)
+{
+    std::string content;
+    FILE * f = fopen(path, "rb");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return content;
+    }
+    char buf[512];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        content.append(buf, n);
+    }
+    fclose(f);
+    return content;
+}
+
+//defaults saved once, as on first boot
+static void first_boot()
+{
+    host_reset();
+    CHECK(CONFIG::reset_config());
+    CONFIG::commit_settings(true);
+}
+
+static void test_esp400()
+{
+    first_boot();
+    //default notification settings are not set by reset
+    CHECK(CONFIG::write_string(ESP_NOTIFICATION_SETTINGS, "my.server.org"));
+    ESPResponseStream response;
+    CONFIG::print_settings("", WEB_PIPE, &response);
+    std::string golden = read_file(ESP400_GOLDEN);
+    CHECK(!golden.empty());
+    CHECK(golden == response.buffer_web.c_str());
+}
+
+//reads come from RAM, writes are saved by one commit once idle
+static void test_cache()
+{
+    first_boot();
+    uint32_t reads = host_flash_reads;
+    uint32_t erases = host_flash_erases;
+    ESPResponseStream response;
+    CONFIG::print_settings("", WEB_PIPE, &response);
+    CHECK(host_flash_reads == reads);
+    CHECK(CONFIG::write_byte(EP_SLEEP_MODE, 1));
+    CHECK(CONFIG::write_string(EP_HOSTNAME, "printer"));
+    CONFIG::commit_settings();
+    CHECK(host_flash_erases == erases);
+    delay(SETTINGS_COMMIT_DELAY + 1);
+    CONFIG::commit_settings();
+    CHECK(host_flash_erases == erases + 1);
+    //same value again is not a change
+    CHECK(CONFIG::write_byte(EP_SLEEP_MODE, 1));
+    delay(SETTINGS_COMMIT_DELAY + 1);
+    CONFIG::commit_settings();
+    CHECK(host_flash_erases == erases + 1);
+    //saved image is the one read after a power cycle
+    host_reboot();
+    byte b = 0;
+    CHECK(CONFIG::read_byte(EP_SLEEP_MODE, &b) && (b == 1));
+    char hostname[MAX_HOSTNAME_LENGTH + 1];
+    CHECK(CONFIG::read_string(EP_HOSTNAME, hostname, MAX_HOSTNAME_LENGTH));
+    CHECK_STR(hostname, "printer");
+    CHECK(CONFIG::get_EEPROM_version() == EEPROM_CURRENT_VERSION);
+}
+
+//a save cut by a power loss is found by its crc and settings are reset
+static void test_power_cut()
+{
+    first_boot();
+    CHECK(CONFIG::write_string(EP_HOSTNAME, "printer"));
+    CHECK(CONFIG::write_byte(EEPROM_SIZE - 20, 0x55));
+    host_flash_cut = EEPROM_SIZE / 2;
+    CONFIG::commit_settings(true);
+    host_reboot();
+    CHECK(CONFIG::get_EEPROM_version() == EEPROM_V0);
+    CHECK(!CONFIG::adjust_EEPROM_settings());
+    CHECK(CONFIG::reset_config());
+    CONFIG::commit_settings(true);
+    host_reboot();
+    CHECK(CONFIG::get_EEPROM_version() == EEPROM_CURRENT_VERSION);
+}
+
+//V2 image has no crc, it is kept and gets one
+static void test_upgrade()
+{
+    first_boot();
+    CHECK(CONFIG::set_EEPROM_version(EEPROM_V2));
+    CHECK(CONFIG::write_string(EP_HOSTNAME, "printer"));
+    CONFIG::commit_settings(true);
+    host_flash[EP_SETTINGS_CRC] = 0xFF;
+    host_flash[EP_SETTINGS_CRC + 1] = 0xFF;
+    host_reboot();
+    CHECK(CONFIG::get_EEPROM_version() == EEPROM_V2);
+    CHECK(CONFIG::adjust_EEPROM_settings());
+    CONFIG::commit_settings(true);
+    host_reboot();
+    CHECK(CONFIG::get_EEPROM_version() == EEPROM_CURRENT_VERSION);
+    char hostname[MAX_HOSTNAME_LENGTH + 1];
+    CHECK(CONFIG::read_string(EP_HOSTNAME, hostname, MAX_HOSTNAME_LENGTH));
+    CHECK_STR(hostname, "printer");
+}
+
+int main()
+{
+    test_esp400();
+    test_cache();
+    test_power_cut();
+    test_upgrade();
+    return test_result("settings");
+}
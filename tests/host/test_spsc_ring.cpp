@@ -0,0 +1,81 @@
+/*
+  test_spsc_ring.cpp - SpscRing host test
+*/
+
+#include "test.h"
+#include "spsc_ring.h"
+#include <thread>
+
+static void test_wrap()
+{
+    uint8_t buffer[16];
+    uint8_t data[16];
+    uint8_t out[16];
+    SpscRing ring(buffer, sizeof(buffer));
+    CHECK(ring.available() == 0);
+    CHECK(ring.free() == 16);
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    //move indexes so next writes wrap around end of buffer
+    CHECK(ring.write(data, 10) == 10);
+    CHECK(ring.read(out, 10) == 10);
+    CHECK(ring.write(data, 16) == 16);
+    CHECK(ring.free() == 0);
+    CHECK(ring.write(data, 1) == 0);
+    CHECK(ring.available() == 16);
+    CHECK(ring.read(out, 16) == 16);
+    CHECK(memcmp(out, data, 16) == 0);
+    CHECK(ring.read(out, 1) == 0);
+    //partial write when full
+    CHECK(ring.write(data, 12) == 12);
+    CHECK(ring.write(data, 12) == 4);
+    CHECK(ring.read(out, 16) == 16);
+    CHECK((out[11] == 11) && (out[12] == 0) && (out[15] == 3));
+}
+
+//one producer and one consumer thread, bytes must come out in order
+static void test_threads()
+{
+    static uint8_t buffer[64];
+    SpscRing ring(buffer, sizeof(buffer));
+    const uint32_t total = 100000;
+    std::thread producer([&ring, total]() {
+        uint32_t sent = 0;
+        uint8_t chunk[7];
+        while (sent < total) {
+            size_t len = ((total - sent) < sizeof(chunk)) ? (total - sent) : sizeof(chunk);
+            for (size_t i = 0; i < len; i++) {
+                chunk[i] = (uint8_t)(sent + i);
+            }
+            size_t done = ring.write(chunk, len);
+            if (done == 0) {
+                std::this_thread::yield();
+            }
+            sent += done;
+        }
+    });
+    uint32_t received = 0;
+    bool ordered = true;
+    uint8_t chunk[5];
+    while (received < total) {
+        size_t len = ring.read(chunk, sizeof(chunk));
+        if (len == 0) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < len; i++) {
+            ordered &= (chunk[i] == (uint8_t)(received + i));
+        }
+        received += len;
+    }
+    producer.join();
+    CHECK(ordered);
+    CHECK(ring.available() == 0);
+}
+
+int main()
+{
+    test_wrap();
+    test_threads();
+    return test_result("spsc_ring");
+}